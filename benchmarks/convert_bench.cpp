@@ -0,0 +1,149 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  convert_bench.cpp
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+/*
+ * Measures the throughput of StringConvert between UTF-8 and char16_t
+ * or char32_t strings:
+ *
+ *   tclap-convert-bench [--text ascii|latin|cjk|emoji]... [--size bytes]...
+ *                       [--min-time seconds]
+ *
+ * Each text is made of a repeated sample, cut to --size bytes of UTF-8,
+ * and is converted from and back to UTF-8 until --min-time has passed.
+ * One JSON object per line is printed for each text, size and character
+ * type, with the megabytes of UTF-8 converted per second each way.
+ *
+ * The CMake build also makes tclap-convert-bench-mbstate, compiled with
+ * TCLAP_NO_UTF8_FAST_PATH, to compare with the mbstate routines.  Both
+ * need a UTF-8 locale: the one of the environment, or C.UTF-8.
+ */
+
+#include <tclap/CmdLine.h>
+
+#include <algorithm>
+#include <chrono>
+#include <clocale>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace TCLAP;
+
+using Clock = std::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct Text {
+	const char* name;
+	const char* sample;
+};
+
+static const Text texts[] = {
+	{"ascii", "--output=/var/tmp/report-2024.txt --verbose --level 3 "},
+	{"latin", "--titre=\xC3\xA9t\xC3\xA9 \xC3\xA0 la fa\xC3\xA7on fran\xC3\xA7" "aise "},
+	{"cjk", "--\xE5\x90\x8D\xE5\x89\x8D=\xE5\xB1\xB1\xE7\x94\xB0\xE5\xA4\xAA\xE9\x83\x8E "},
+	{"emoji", "\xF0\x9F\x98\x80\xF0\x9F\x9A\x80 ok \xF0\x9F\x8E\x89 "},
+};
+
+/**
+ * Returns the sample repeated and cut to at most size bytes, at the
+ * start of a character.
+ */
+static std::string makeText(const std::string& sample, std::size_t size) {
+	std::string text;
+	while (text.size() < size) text += sample;
+	std::size_t end = size;
+	while (end > 0 && (static_cast<unsigned char>(text[end]) & 0xC0) == 0x80) end--;
+	return text.substr(0, end);
+}
+
+template<typename T_Char>
+static void run(const char* charName, const char* textName, const std::string& text, double minTime) {
+	std::basic_string<T_Char> converted = StringConvert<T_Char>::fromMBString(text);
+	if (StringConvert<T_Char>::toMBString(converted) != text) {
+		std::cout << "{\"char\":\"" << charName << "\",\"text\":\"" << textName
+			<< "\",\"error\":\"round trip changed the text\"}" << std::endl;
+		return;
+	}
+
+	std::size_t reps = 0;
+	std::size_t check = 0;
+	double fromTime = 0;
+	Clock::time_point start = Clock::now();
+	do {
+		check += StringConvert<T_Char>::fromMBString(text).size();
+		reps++;
+	} while ((fromTime = secondsSince(start)) < minTime);
+	double fromRate = text.size() * reps / fromTime / 1e6;
+
+	reps = 0;
+	double toTime = 0;
+	start = Clock::now();
+	do {
+		check += StringConvert<T_Char>::toMBString(converted).size();
+		reps++;
+	} while ((toTime = secondsSince(start)) < minTime);
+	double toRate = text.size() * reps / toTime / 1e6;
+
+	std::cout << "{\"char\":\"" << charName << "\",\"text\":\"" << textName
+		<< "\",\"bytes\":" << text.size()
+		<< ",\"fast_path\":" << (Utf8Transcoder<T_Char>::enabled ? "true" : "false")
+		<< ",\"from_utf8_mb_per_sec\":" << static_cast<long long>(fromRate)
+		<< ",\"to_utf8_mb_per_sec\":" << static_cast<long long>(toRate)
+		<< ",\"check\":" << check % 10 << "}" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	try {
+		CmdLine<> cmd("Benchmarks StringConvert between UTF-8 and UTF-16 or UTF-32", ' ', "1.0");
+		MultiArg<std::string> names("x", "text", "Text: ascii, latin, cjk or emoji, all by default", false, "name", cmd);
+		MultiArg<std::size_t> sizes("s", "size", "Size of a text in bytes, 64 and 65536 by default", false, "bytes", cmd);
+		ValueArg<double> minTime("t", "min-time", "Seconds to repeat each conversion for", false, 0.2, "seconds", cmd);
+		cmd.parse(argc, argv);
+
+		if (!std::setlocale(LC_ALL, "") || !Utf8Transcoder<char32_t>::isUtf8Locale()) {
+			if (!std::setlocale(LC_ALL, "C.UTF-8") || !Utf8Transcoder<char32_t>::isUtf8Locale()) {
+				std::cerr << "error: no UTF-8 locale" << std::endl;
+				return 1;
+			}
+		}
+
+		std::vector<std::size_t> byteCounts = sizes.getValue();
+		if (byteCounts.empty()) byteCounts = {64, 65536};
+		for (const Text& t : texts) {
+			const std::vector<std::string>& wanted = names.getValue();
+			if (!wanted.empty() && std::find(wanted.begin(), wanted.end(), t.name) == wanted.end())
+				continue;
+			for (std::size_t size : byteCounts) {
+				std::string text = makeText(t.sample, size);
+				run<char16_t>("char16_t", t.name, text, minTime.getValue());
+				run<char32_t>("char32_t", t.name, text, minTime.getValue());
+			}
+		}
+	} catch (ArgException<>& e) {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,298 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  parse_bench.cpp
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/*
+ * Measures CmdLine::parse on synthetic specs of 10 to 10000 Args:
+ *
+ *   tclap-parse-bench [--args N]... [--char char|wchar_t|char32_t]...
+ *                     [--workload flags|clusters|positionals|xor]...
+ *                     [--min-time seconds]
+ *
+ * A spec of N Args cycles through SwitchArg, MultiSwitchArg, string
+ * ValueArg, string MultiArg and string ValueArgs that are xor'ed in
+ * groups of four, and ends with an UnlabeledMultiArg.  The first
+ * MultiSwitchArgs get single letter flags, the other Args only have a
+ * name.  Every command line names one Arg of each xor group, then:
+ *
+ *   flags        every other labeled Arg once, by name
+ *   clusters     about N switches, combined into tokens of all letters
+ *   positionals  N unlabeled values
+ *   xor          nothing else, naming the last Arg of each group
+ *
+ * Each spec is built for each character type, and each command line is
+ * parsed again until --min-time has passed.  One JSON object per line is
+ * printed for every spec and command line, with the time to build the
+ * spec, the time and heap allocations of a parse, and the tokens parsed
+ * per second.  The allocations are counted by replacing the global
+ * operator new, so they include those of the standard library.
+ */
+
+#include <tclap/CmdLine.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace TCLAP;
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+	allocations++;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+// operator new above allocates with malloc, which GCC doesn't see
+// where operator delete is inlined.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static const char letters[] = "abcdefgijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+template<typename T_Char>
+static std::basic_string<T_Char> widen(const std::string& s) {
+	return std::basic_string<T_Char>(s.begin(), s.end());
+}
+
+/**
+ * A synthetic spec of count Args, along with the names needed to
+ * write command lines for it.
+ */
+template<typename T_Char>
+struct Spec {
+	using StringType = std::basic_string<T_Char>;
+
+	explicit Spec(std::size_t count);
+
+	std::vector<std::unique_ptr<Arg<T_Char>>> args;
+	CmdLine<T_Char> cmd;
+	std::vector<std::string> labeled;
+	std::vector<bool> takesValue;
+	std::string cluster;
+	std::vector<std::vector<std::string>> xorGroups;
+};
+
+template<typename T_Char>
+Spec<T_Char>::Spec(std::size_t count)
+	: args(), cmd(widen<T_Char>("Parse benchmark"), T_Char(' '), widen<T_Char>("1.0")),
+	labeled(), takesValue(), cluster(), xorGroups() {
+	cmd.setExceptionHandling(false);
+	std::vector<Arg<T_Char>*> group;
+	for (std::size_t i = 0; i < count; i++) {
+		std::string n = std::to_string(i);
+		StringType desc = widen<T_Char>("description " + n);
+		switch (i % 5) {
+			case 0:
+				args.emplace_back(new SwitchArg<T_Char>(StringType(), widen<T_Char>("switch-" + n), desc));
+				labeled.push_back("switch-" + n);
+				takesValue.push_back(false);
+				break;
+			case 1: {
+				std::string flag;
+				if (cluster.size() < sizeof(letters) - 1)
+					flag = std::string(1, letters[cluster.size()]);
+				cluster += flag;
+				args.emplace_back(new MultiSwitchArg<T_Char>(widen<T_Char>(flag), widen<T_Char>("count-" + n), desc));
+				labeled.push_back("count-" + n);
+				takesValue.push_back(false);
+				break;
+			}
+			case 2:
+				args.emplace_back(new ValueArg<StringType, T_Char>(StringType(), widen<T_Char>("value-" + n), desc, false, StringType(), widen<T_Char>("string")));
+				labeled.push_back("value-" + n);
+				takesValue.push_back(true);
+				break;
+			case 3:
+				args.emplace_back(new MultiArg<StringType, T_Char>(StringType(), widen<T_Char>("multi-" + n), desc, false, widen<T_Char>("string")));
+				labeled.push_back("multi-" + n);
+				takesValue.push_back(true);
+				break;
+			case 4:
+				args.emplace_back(new ValueArg<StringType, T_Char>(StringType(), widen<T_Char>("xor-" + n), desc, false, StringType(), widen<T_Char>("string")));
+				if (group.empty()) xorGroups.emplace_back();
+				xorGroups.back().push_back("xor-" + n);
+				group.push_back(args.back().get());
+				if (group.size() == 4) {
+					cmd.xorAdd(group);
+					group.clear();
+				}
+				continue;
+		}
+		cmd.add(*args.back());
+	}
+	if (!group.empty())
+		cmd.xorAdd(group);
+	args.emplace_back(new UnlabeledMultiArg<StringType, T_Char>(widen<T_Char>("files"), widen<T_Char>("input files"), false, widen<T_Char>("file")));
+	cmd.add(*args.back());
+}
+
+/**
+ * Returns the command line of a workload for spec.
+ */
+template<typename T_Char>
+static std::vector<std::basic_string<T_Char>> commandLine(const Spec<T_Char>& spec, const std::string& workload, std::size_t count) {
+	std::vector<std::string> argv{"parse_bench"};
+	for (const std::vector<std::string>& group : spec.xorGroups) {
+		argv.push_back("--" + (workload == "xor" ? group.back() : group.front()));
+		argv.push_back("x");
+	}
+	if (workload == "flags") {
+		for (std::size_t i = 0; i < spec.labeled.size(); i++) {
+			argv.push_back("--" + spec.labeled[i]);
+			if (spec.takesValue[i]) argv.push_back("v" + std::to_string(i));
+		}
+	} else if (workload == "clusters" && !spec.cluster.empty()) {
+		for (std::size_t n = 0; n < count; n += spec.cluster.size())
+			argv.push_back("-" + spec.cluster);
+	} else if (workload == "positionals") {
+		for (std::size_t i = 0; i < count; i++)
+			argv.push_back("file-" + std::to_string(i));
+	}
+	std::vector<std::basic_string<T_Char>> result;
+	for (const std::string& arg : argv) result.push_back(widen<T_Char>(arg));
+	return result;
+}
+
+/**
+ * Whether s was chosen from list by the user, which is everything when
+ * the list is empty.
+ */
+static bool isSelected(const std::vector<std::string>& list, const std::string& s) {
+	return list.empty() || std::find(list.begin(), list.end(), s) != list.end();
+}
+
+/**
+ * Returns s as a quoted JSON string.
+ */
+static std::string jsonString(const std::string& s) {
+	static const char hex[] = "0123456789abcdef";
+	std::string out = "\"";
+	for (char ch : s) {
+		unsigned char uch = static_cast<unsigned char>(ch);
+		if (ch == '"' || ch == '\\') {
+			out += '\\';
+			out += ch;
+		} else if (uch < 0x20) {
+			out += "\\u00";
+			out += hex[uch >> 4];
+			out += hex[uch & 0xf];
+		} else {
+			out += ch;
+		}
+	}
+	return out + "\"";
+}
+
+template<typename T_Char>
+static void run(const char* charName, std::size_t count, const std::vector<std::string>& workloads, double minTime) {
+	// Build the spec until minTime has passed too, keeping the last one.
+	std::unique_ptr<Spec<T_Char>> spec;
+	std::size_t builds = 0;
+	double buildTime = 0;
+	do {
+		spec.reset();
+		Clock::time_point start = Clock::now();
+		spec.reset(new Spec<T_Char>(count));
+		buildTime += secondsSince(start);
+		builds++;
+	} while (buildTime < minTime);
+
+	for (const char* workload : {"flags", "clusters", "positionals", "xor"}) {
+		if (!isSelected(workloads, workload)) continue;
+		const std::vector<std::basic_string<T_Char>> argv = commandLine(*spec, workload, count);
+		std::size_t reps = 0;
+		std::size_t allocs = 0;
+		double parseTime = 0;
+		std::string error;
+		do {
+			std::vector<std::basic_string<T_Char>> copy = argv;
+			spec->cmd.reset();
+			std::size_t allocsBefore = allocations;
+			Clock::time_point start = Clock::now();
+			try {
+				spec->cmd.parse(copy);
+			} catch (ArgException<T_Char>& e) {
+				error = StringConvert<T_Char>::toMBString(e.argId() + widen<T_Char>(": ") + e.error());
+			}
+			parseTime += secondsSince(start);
+			allocs += allocations - allocsBefore;
+			reps++;
+		} while (error.empty() && parseTime < minTime);
+
+		std::size_t tokens = argv.size() - 1;
+		std::cout << "{\"char\":\"" << charName << "\",\"args\":" << count
+			<< ",\"workload\":\"" << workload << "\",\"tokens\":" << tokens
+			<< ",\"build_ns\":" << static_cast<long long>(buildTime / builds * 1e9)
+			<< ",\"parses\":" << reps
+			<< ",\"parse_ns\":" << static_cast<long long>(parseTime / reps * 1e9)
+			<< ",\"allocs_per_parse\":" << allocs / reps
+			<< ",\"tokens_per_sec\":" << static_cast<long long>(tokens * reps / parseTime);
+		if (!error.empty())
+			std::cout << ",\"error\":" << jsonString(error);
+		std::cout << "}" << std::endl;
+	}
+}
+
+int main(int argc, char** argv) {
+	try {
+		CmdLine<> cmd("Benchmarks CmdLine::parse on synthetic specs", ' ', "1.0");
+		MultiArg<std::size_t> counts("n", "args", "Number of Args in a spec, 10, 100, 1000 and 10000 by default", false, "count", cmd);
+		MultiArg<std::string> chars("c", "char", "Character type: char, wchar_t or char32_t, all by default", false, "type", cmd);
+		MultiArg<std::string> workloads("w", "workload", "Command line: flags, clusters, positionals or xor, all by default", false, "name", cmd);
+		ValueArg<double> minTime("t", "min-time", "Seconds to repeat each build and parse for", false, 0.2, "seconds", cmd);
+		cmd.parse(argc, argv);
+
+		std::vector<std::size_t> sizes = counts.getValue();
+		if (sizes.empty()) sizes = {10, 100, 1000, 10000};
+		for (std::size_t count : sizes) {
+			if (isSelected(chars.getValue(), "char"))
+				run<char>("char", count, workloads.getValue(), minTime.getValue());
+			if (isSelected(chars.getValue(), "wchar_t"))
+				run<wchar_t>("wchar_t", count, workloads.getValue(), minTime.getValue());
+			if (isSelected(chars.getValue(), "char32_t"))
+				run<char32_t>("char32_t", count, workloads.getValue(), minTime.getValue());
+		}
+	} catch (ArgException<>& e) {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+		return 1;
+	}
+}
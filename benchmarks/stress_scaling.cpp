@@ -0,0 +1,267 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  stress_scaling.cpp
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/*
+ * Looks for code paths that grow faster than their input:
+ *
+ *   tclap-stress [--shape name]... [--min-size N] [--max-size N]
+ *                [--max-seconds s] [--threshold exponent]
+ *                [--tolerance exponent]
+ *
+ * Each shape is an input that stresses one code path.  Its size is
+ * doubled from --min-size to --max-size, or until a run takes longer
+ * than --max-seconds, and the fastest of several runs is kept at each
+ * size.  The exponent k of time ~ size^k is then fitted by least squares
+ * on the logarithms, and a shape is super-linear when k is above
+ * --threshold.  Each shape also has the exponent its code path is
+ * known to have, and it is a regression when k exceeds that by more
+ * than --tolerance, which leaves room for cache effects at large sizes.
+ * One JSON object per line is printed for each shape, and the exit
+ * status is 1 when any of them is a regression.
+ *
+ *   combined-switches  one cluster of N copies of a MultiSwitchArg flag
+ *   xor-check          XorHandler::check for each of N xor groups
+ *   add-args           CmdLine::add of N Args
+ *   zsh-quote          ZshCompletionOutput quoting N ':' and '\'' chars
+ *   many-tokens        N occurrences of one MultiArg
+ *   positionals        N values of an UnlabeledMultiArg
+ *   long-arg-list      one token matched against a list of N Args
+ */
+
+#include <tclap/CmdLine.h>
+#include <tclap/ZshCompletionOutput.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace TCLAP;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Prepares an input of a given size and returns the operation to time,
+ * which can be run repeatedly.
+ */
+using Prepare = std::function<std::function<void()>(std::size_t)>;
+
+struct Shape {
+	const char* name;
+	const char* path;
+	double expected;
+	Prepare prepare;
+};
+
+/**
+ * Gives access to ZshCompletionOutput::quoteSpecialChars.
+ */
+class QuotingOutput : public ZshCompletionOutput<> {
+	public:
+		using ZshCompletionOutput<>::quoteSpecialChars;
+};
+
+/**
+ * A CmdLine that doesn't handle exceptions, along with Args it owns.
+ */
+struct Spec {
+	Spec() : cmd("Stress", ' ', "1.0"), args() { cmd.setExceptionHandling(false); }
+
+	CmdLine<> cmd;
+	std::vector<std::unique_ptr<Arg<>>> args;
+};
+
+static std::vector<std::string> repeat(std::size_t n, const std::vector<std::string>& tokens) {
+	std::vector<std::string> argv{"stress"};
+	for (std::size_t i = 0; i < n; i++)
+		argv.insert(argv.end(), tokens.begin(), tokens.end());
+	return argv;
+}
+
+/**
+ * Returns an operation parsing argv with spec.
+ */
+static std::function<void()> parsing(std::shared_ptr<Spec> spec, std::vector<std::string> argv) {
+	return [spec, argv]() {
+		std::vector<std::string> copy = argv;
+		spec->cmd.reset();
+		spec->cmd.parse(copy);
+	};
+}
+
+static std::vector<Shape> shapes() {
+	std::vector<Shape> list;
+
+	list.push_back({"combined-switches", "MultiSwitchArg::processArg", 1, [](std::size_t n) {
+		std::shared_ptr<Spec> spec = std::make_shared<Spec>();
+		spec->args.emplace_back(new MultiSwitchArg<>("a", "all", "Counted switch", spec->cmd));
+		return parsing(spec, {"stress", "-" + std::string(n, 'a')});
+	}});
+
+	list.push_back({"xor-check", "XorHandler::check", 1, [](std::size_t n) {
+		std::shared_ptr<std::vector<std::unique_ptr<Arg<>>>> args = std::make_shared<std::vector<std::unique_ptr<Arg<>>>>();
+		std::shared_ptr<XorHandler<>> handler = std::make_shared<XorHandler<>>();
+		for (std::size_t i = 0; i < n; i++) {
+			std::string id = std::to_string(i);
+			args->emplace_back(new SwitchArg<>("", "a" + id, "First of group " + id));
+			args->emplace_back(new SwitchArg<>("", "b" + id, "Second of group " + id));
+			handler->add({(*args)[2 * i].get(), (*args)[2 * i + 1].get()});
+		}
+		return std::function<void()>([args, handler]() {
+			for (std::size_t i = 0; i < args->size(); i += 2) {
+				(*args)[i]->reset();
+				handler->check((*args)[i].get());
+			}
+		});
+	}});
+
+	list.push_back({"add-args", "CmdLine::add", 1, [](std::size_t n) {
+		std::shared_ptr<std::vector<std::unique_ptr<Arg<>>>> args = std::make_shared<std::vector<std::unique_ptr<Arg<>>>>();
+		for (std::size_t i = 0; i < n; i++)
+			args->emplace_back(new SwitchArg<>("", "s" + std::to_string(i), "Switch"));
+		return std::function<void()>([args]() {
+			CmdLine<> cmd("Stress", ' ', "1.0");
+			for (std::unique_ptr<Arg<>>& arg : *args)
+				cmd.add(*arg);
+		});
+	}});
+
+	list.push_back({"zsh-quote", "ZshCompletionOutput::quoteSpecialChars", 1, [](std::size_t n) {
+		std::shared_ptr<QuotingOutput> output = std::make_shared<QuotingOutput>();
+		std::string text;
+		for (std::size_t i = 0; i < n; i++)
+			text += (i % 2 ? '\'' : ':');
+		return std::function<void()>([output, text]() {
+			std::string copy = text;
+			output->quoteSpecialChars(copy);
+		});
+	}});
+
+	list.push_back({"many-tokens", "CmdLine::parse", 1, [](std::size_t n) {
+		std::shared_ptr<Spec> spec = std::make_shared<Spec>();
+		spec->args.emplace_back(new MultiArg<std::string>("m", "multi", "Repeated value", false, "string", spec->cmd));
+		return parsing(spec, repeat(n, {"-m", "v"}));
+	}});
+
+	list.push_back({"positionals", "UnlabeledMultiArg::processArg", 1, [](std::size_t n) {
+		std::shared_ptr<Spec> spec = std::make_shared<Spec>();
+		spec->args.emplace_back(new UnlabeledMultiArg<std::string>("files", "Input files", false, "file", spec->cmd));
+		return parsing(spec, repeat(n, {"file"}));
+	}});
+
+	list.push_back({"long-arg-list", "CmdLine::_matchArg", 1, [](std::size_t n) {
+		std::shared_ptr<Spec> spec = std::make_shared<Spec>();
+		for (std::size_t i = 0; i < n; i++)
+			spec->args.emplace_back(new SwitchArg<>("", "s" + std::to_string(i), "Switch", spec->cmd));
+		return parsing(spec, {"stress", "--s0"});
+	}});
+
+	return list;
+}
+
+/**
+ * Returns the fastest of at least three runs of op, repeated for at
+ * least 20ms.
+ */
+static double fastest(const std::function<void()>& op) {
+	double best = 0;
+	double total = 0;
+	for (int runs = 0; runs < 3 || total < 0.02; runs++) {
+		Clock::time_point start = Clock::now();
+		op();
+		double t = std::chrono::duration<double>(Clock::now() - start).count();
+		if (runs == 0 || t < best) best = t;
+		total += t;
+	}
+	return best;
+}
+
+/**
+ * Returns the slope of the least squares line through the logarithms
+ * of the points.
+ */
+static double exponent(const std::vector<std::size_t>& sizes, const std::vector<double>& times) {
+	double n = static_cast<double>(sizes.size());
+	double sx = 0, sy = 0, sxx = 0, sxy = 0;
+	for (std::size_t i = 0; i < sizes.size(); i++) {
+		double x = std::log(static_cast<double>(sizes[i]));
+		double y = std::log(std::max(times[i], 1e-9));
+		sx += x;
+		sy += y;
+		sxx += x * x;
+		sxy += x * y;
+	}
+	double d = n * sxx - sx * sx;
+	return d == 0 ? 0 : (n * sxy - sx * sy) / d;
+}
+
+int main(int argc, char** argv) {
+	try {
+		CmdLine<> cmd("Fits the growth of the time of each stressed code path", ' ', "1.0");
+		MultiArg<std::string> names("s", "shape", "Shape to run, all by default", false, "name", cmd);
+		ValueArg<std::size_t> minSize("", "min-size", "Smallest input size", false, 256, "count", cmd);
+		ValueArg<std::size_t> maxSize("", "max-size", "Largest input size", false, 65536, "count", cmd);
+		ValueArg<double> maxSeconds("", "max-seconds", "Stop growing a shape once a run takes this long", false, 0.25, "seconds", cmd);
+		ValueArg<double> threshold("", "threshold", "Largest exponent considered linear", false, 1.3, "exponent", cmd);
+		ValueArg<double> tolerance("", "tolerance", "How far the exponent may exceed the expected one", false, 0.5, "exponent", cmd);
+		cmd.parse(argc, argv);
+
+		bool regressed = false;
+		for (const Shape& shape : shapes()) {
+			const std::vector<std::string>& wanted = names.getValue();
+			if (!wanted.empty() && std::find(wanted.begin(), wanted.end(), shape.name) == wanted.end())
+				continue;
+
+			std::vector<std::size_t> sizes;
+			std::vector<double> times;
+			for (std::size_t n = std::max<std::size_t>(minSize.getValue(), 1); n <= maxSize.getValue(); n *= 2) {
+				double t = fastest(shape.prepare(n));
+				sizes.push_back(n);
+				times.push_back(t);
+				if (t > maxSeconds.getValue()) break;
+			}
+
+			double k = exponent(sizes, times);
+			bool flagged = sizes.size() > 1 && k > threshold.getValue();
+			bool regression = sizes.size() > 1 && k > shape.expected + tolerance.getValue();
+			regressed = regressed || regression;
+			std::cout << "{\"shape\":\"" << shape.name << "\",\"path\":\"" << shape.path << "\",\"sizes\":[";
+			for (std::size_t i = 0; i < sizes.size(); i++)
+				std::cout << (i ? "," : "") << sizes[i];
+			std::cout << "],\"ns\":[";
+			for (std::size_t i = 0; i < times.size(); i++)
+				std::cout << (i ? "," : "") << static_cast<long long>(times[i] * 1e9);
+			std::cout << "],\"exponent\":" << std::round(k * 100) / 100
+				<< ",\"expected\":" << shape.expected
+				<< ",\"superlinear\":" << (flagged ? "true" : "false")
+				<< ",\"regression\":" << (regression ? "true" : "false") << "}" << std::endl;
+		}
+		return regressed ? 1 : 0;
+	} catch (ArgException<>& e) {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+		return 2;
+	}
+}
@@ -0,0 +1,17 @@
+# tclap_generate_parser(<target> <spec> <header>)
+#
+# Runs tclap-gen on <spec> to generate <header> in the current binary
+# directory, and makes <target> depend on it, include it and use TCLAP.
+# The header is regenerated whenever the spec or the generator changes.
+function(tclap_generate_parser target spec header)
+	get_filename_component(spec_path "${spec}" ABSOLUTE)
+	set(header_path "${CMAKE_CURRENT_BINARY_DIR}/${header}")
+	add_custom_command(OUTPUT "${header_path}"
+		COMMAND tclap-gen "${spec_path}" "${header_path}"
+		DEPENDS tclap-gen "${spec_path}"
+		COMMENT "Generating ${header} from ${spec}"
+		VERBATIM)
+	target_sources(${target} PRIVATE "${header_path}")
+	target_include_directories(${target} PRIVATE "${CMAKE_CURRENT_BINARY_DIR}")
+	target_link_libraries(${target} PRIVATE TCLAP)
+endfunction()
@@ -0,0 +1,47 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	// Define the command line object and have it pool the
+	// text of its Args.
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+	cmd.setStringPooling(true);
+
+	// Args added after pooling has been enabled are interned by add().
+	ValueArg<string> nameArg("n","name","Name to print",true,"homer","string");
+	cmd.add( nameArg );
+
+	ValueArg<int> countArg("c","count","Number of times to print",false,1,"int");
+	cmd.add( countArg );
+
+	// A requireLabel set from a temporary is copied, then pooled too.
+	ValueArg<string> dirArg("d","dir","Directory to work in",true,".","string");
+	dirArg.setRequireLabel( string("needed") );
+	cmd.add( dirArg );
+
+	// Args sharing a description share its storage too.
+	SwitchArg<> upperSwitch("u","upper","Change the case", false);
+	SwitchArg<> lowerSwitch("l","lower","Change the case", false);
+	cmd.xorAdd( upperSwitch, lowerSwitch );
+
+	// Parse the args.
+	cmd.parse( argc, argv );
+
+	for ( const Arg<>* arg : cmd.getArgList() )
+		cout << arg->longID() << " -- " << arg->getDescription() << endl;
+
+	for ( int i = 0; i < countArg.getValue(); i++ )
+		cout << "My name is: " << nameArg.getValue() << endl;
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
@@ -0,0 +1,43 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// Help text that lives in a static table and is never copied.
+static const char* const descriptions[] = {
+	"Number of iterations",
+	"Enable extra checks",
+};
+
+static int loads = 0;
+
+int main(int argc, char** argv)
+{
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	ValueArg<int> countArg("c","count","",false,1,"int");
+	countArg.setDescription(descriptions[0]);
+	cmd.add( countArg );
+
+	// The loader only runs when the description is printed.
+	SwitchArg<> checkSwitch("x","check","", false);
+	checkSwitch.setDescription([]() { loads++; return string(descriptions[1]); });
+	cmd.add( checkSwitch );
+
+	cmd.parse( argc, argv );
+
+	cout << "loads after parse: " << loads << endl;
+
+	cmd.getOutput()->usage(cmd);
+
+	cout << "loads after usage: " << loads << endl;
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
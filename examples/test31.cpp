@@ -0,0 +1,67 @@
+#include <string>
+#include <iostream>
+#include <memory>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// Each subcommand is a CmdLine that owns its Args.
+struct BuildCmd : public CmdLine<> {
+	ValueArg<int> jobsArg;
+	SwitchArg<> releaseSwitch;
+	UnlabeledValueArg<string> targetArg;
+	BuildCmd() : CmdLine<>("Builds the targets", ' ', "0.9"),
+		jobsArg("j","jobs","Number of jobs",false,1,"int",*this),
+		releaseSwitch("r","release","Optimized build",*this,false),
+		targetArg("target","Target to build",false,"all","string",*this)
+	{ cout << "building spec: build" << endl; }
+};
+
+struct CleanCmd : public CmdLine<> {
+	UnlabeledMultiArg<string> targetsArg;
+	CleanCmd() : CmdLine<>("Removes the targets", ' ', "0.9"),
+		targetsArg("targets","Targets to remove",false,"string",*this)
+	{ cout << "building spec: clean" << endl; }
+};
+
+int main(int argc, char** argv)
+{
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	CmdLine<> cmd("Multi tool", ' ', "0.9");
+
+	// Global options come before the subcommand.
+	SwitchArg<> verboseSwitch("v","verbose","Verbose output",cmd,false);
+
+	SubcommandArg<> commandArg("command","The command to run",true,cmd);
+	commandArg.add("build", []() { return make_unique<BuildCmd>(); });
+	commandArg.add("clean", []() { return make_unique<CleanCmd>(); });
+
+	cmd.parse( argc, argv );
+
+	cout << "verbose: " << verboseSwitch.getValue() << endl;
+	cout << "command: " << commandArg.getValue() << endl;
+
+	// Only the selected subcommand gets built and parsed.
+	CmdLineInterface<>* sub = commandArg.parse();
+
+	// The spec of the subcommand does not leak into this CmdLine.
+	cout << "optional unlabeled: " << OptionalUnlabeledTracker<>::alreadyOptional() << endl;
+
+	if ( commandArg.getValue() == "build" ) {
+		BuildCmd* build = static_cast<BuildCmd*>(sub);
+		cout << "jobs: " << build->jobsArg.getValue() << endl;
+		cout << "release: " << build->releaseSwitch.getValue() << endl;
+		cout << "target: " << build->targetArg.getValue() << endl;
+	} else {
+		CleanCmd* clean = static_cast<CleanCmd*>(sub);
+		for ( const string& target : clean->targetsArg.getValue() )
+			cout << "target: " << target << endl;
+	}
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
@@ -0,0 +1,56 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+using Table = ArgTable<>;
+
+// A compact, static description of the experiment flags.  None of
+// these become real Args unless they are used.
+static const Table::Descriptor experiments[] = {
+	Table::value<int>("i", "iterations", "Number of iterations", "10", "int"),
+	Table::value<double>("", "rate", "Learning rate", "0.5", "double"),
+	Table::value<string>("", "tag", "Run tag", "none", "string"),
+	Table::switchArg("x", "extra", "Enable extra checks"),
+	Table::switchArg("q", "quiet", "Less output"),
+};
+
+// Entries that clash with the -h and --version of the CmdLine.
+static const Table::Descriptor clashing[] = {
+	Table::switchArg("h", "hush", "Even less output"),
+	Table::switchArg("", "version", "Version to compare against"),
+};
+
+int main(int argc, char** argv)
+{
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	Table experimentsTable("experiments", "Experiment flags:", cmd);
+	experimentsTable.add( experiments );
+
+	cmd.parse( argc, argv );
+
+	for ( const Table::Descriptor& d : clashing )
+		try {
+			experimentsTable.add( span<const Table::Descriptor>(&d, 1) );
+		} catch (SpecificationException<>& e)
+		{ cout << "rejected: " << e.argId() << endl; }
+
+	cout << "entries: " << experimentsTable.count() << endl;
+	cout << "materialized after parse: " << experimentsTable.countMaterialized() << endl;
+
+	cout << "iterations: " << experimentsTable.getValue<int>("iterations") << endl;
+	cout << "rate: " << experimentsTable.getValue<double>("rate") << endl;
+	cout << "extra: " << experimentsTable.getSwitch("extra") << endl;
+
+	cout << "materialized after queries: " << experimentsTable.countMaterialized() << endl;
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
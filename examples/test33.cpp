@@ -0,0 +1,88 @@
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include "tclap/CmdLine.h"
+#include "tclap/ArgTableImage.h"
+
+using namespace TCLAP;
+using namespace std;
+
+using Table = ArgTable<>;
+using Image = ArgTableImage<>;
+
+static const Table::Descriptor experiments[] = {
+	Table::value<int>("i", "iterations", "Number of iterations", "10", "int"),
+	Table::value<string>("", "tag", "Run tag", "none", "string"),
+	Table::switchArg("x", "extra", "Enable extra checks"),
+};
+
+// The kinds must be listed in the same order when writing and loading.
+static const Table::MakeArgType kinds[] = {
+	&Table::makeSwitchArg,
+	&Table::makeValueArg<int>,
+	&Table::makeValueArg<string>,
+};
+
+int main(int argc, char** argv)
+{
+	// Normally the image is written at build time and mapped from a
+	// file at startup.  Here it is kept in memory.
+	ostringstream os(ios::binary);
+	Image::write(os, experiments, kinds);
+	string bytes = os.str();
+	vector<uint32_t> buffer((bytes.size() + 3) / 4);
+	memcpy(buffer.data(), bytes.data(), bytes.size());
+	span<const byte> image(reinterpret_cast<const byte*>(buffer.data()), bytes.size());
+
+	try {
+		vector<uint32_t> corrupt(buffer);
+		reinterpret_cast<char*>(corrupt.data())[0] = 'X';
+		Image bad(span<const byte>(reinterpret_cast<const byte*>(corrupt.data()), bytes.size()), kinds);
+	} catch (SpecificationException<>& e) {
+		cout << "corrupt image: " << e.error() << " (" << e.argId() << ")" << endl;
+	}
+
+	try {
+		// The index follows the header and the entries.
+		vector<uint32_t> unsorted(buffer);
+		swap(unsorted[8 + 11 * 3], unsorted[8 + 11 * 3 + 1]);
+		Image bad(span<const byte>(reinterpret_cast<const byte*>(unsorted.data()), bytes.size()), kinds);
+		CmdLine<> cmd("Command description message", ' ', "0.9");
+		Table badTable("experiments", "Experiment flags:", cmd);
+		bad.addTo( badTable );
+	} catch (SpecificationException<>& e) {
+		cout << "unsorted index: " << e.error() << " (" << e.argId() << ")" << endl;
+	}
+
+	try {
+		// A stream without a buffer fails every write.
+		ostream nowhere(nullptr);
+		Image::write(nowhere, experiments, kinds);
+	} catch (SpecificationException<>& e) {
+		cout << "failed write: " << e.error() << endl;
+	}
+
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	Image loaded(image, kinds);
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	Table experimentsTable("experiments", "Experiment flags:", cmd);
+	// The table uses the index stored in the image.
+	loaded.addTo( experimentsTable );
+
+	cmd.parse( argc, argv );
+
+	cout << "entries: " << experimentsTable.count() << endl;
+	cout << "iterations: " << experimentsTable.getValue<int>("iterations") << endl;
+	cout << "tag: " << experimentsTable.getValue<string>("tag") << endl;
+	cout << "extra: " << experimentsTable.getSwitch("extra") << endl;
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
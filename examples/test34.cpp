@@ -0,0 +1,42 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include "tclap/StaticCmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+struct Options {
+	int iterations = 10;
+	string tag = "none";
+	vector<int> levels;
+	bool extra = false;
+	bool quiet = false;
+};
+
+// Declared constexpr, so a duplicate flag or name fails to compile.
+static constexpr auto cmd = makeStaticCmdLine(
+	staticValueArg("i", "iterations", "Number of iterations", "int", &Options::iterations),
+	staticValueArg("t", "tag", "Run tag", "string", &Options::tag, true),
+	staticMultiArg("l", "level", "Levels to run", "int", &Options::levels),
+	staticSwitchArg("x", "extra", "Enable extra checks", &Options::extra),
+	staticSwitchArg("q", "quiet", "Less output", &Options::quiet));
+
+int main(int argc, char** argv)
+{
+	try {
+
+	Options opts = cmd.parse( argc, argv );
+
+	cout << "iterations: " << opts.iterations << endl;
+	cout << "tag: " << opts.tag << endl;
+	cout << "levels:";
+	for ( int level : opts.levels )
+		cout << " " << level;
+	cout << endl;
+	cout << "extra: " << opts.extra << endl;
+	cout << "quiet: " << opts.quiet << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
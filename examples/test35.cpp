@@ -0,0 +1,73 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include "tclap/VariantCmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// A user-defined Arg is still dispatched virtually.
+class CountingSwitchArg : public SwitchArg<>
+{
+	public:
+		CountingSwitchArg(const string& flag, const string& name, const string& desc)
+		: SwitchArg<>(flag, name, desc), matches(0) {}
+
+		virtual bool processArg(size_t& i, vector<string>& args) override
+		{
+			bool matched = SwitchArg<>::processArg(i, args);
+			if ( matched ) matches++;
+			return matched;
+		}
+
+		int matches;
+};
+
+int main(int argc, char** argv)
+{
+	try {
+
+	VariantCmdLine<> cmd("Command description message", ' ', "0.9");
+
+	ValueArg<int> itest("i", "iterations", "Number of iterations", false, 10, "int", cmd);
+	ValueArg<double> ftest("f", "factor", "Scale factor", false, 1.5, "double", cmd);
+	MultiArg<string> ltest("l", "level", "Levels to run", true, "string", cmd);
+	SwitchArg<> xtest("x", "extra", "Enable extra checks", cmd);
+	MultiSwitchArg<> vtest("v", "verbose", "Verbosity", cmd);
+	UnlabeledMultiArg<string> files("files", "Input files", false, "file", cmd);
+
+	// xor and required checks go through the variant too
+	ValueArg<string> ntest("n", "name", "Run name", true, "", "string");
+	ValueArg<long> ctest("c", "count", "Run count", true, 0, "long");
+	cmd.xorAdd( ntest, ctest );
+
+	CountingSwitchArg qtest("q", "quiet", "Less output");
+	cmd.add( qtest );
+
+	cmd.parse( argc, argv );
+
+	int virtualArgs = 0;
+	for ( Arg<>* arg : cmd.getArgList() )
+		if ( VariantCmdLine<>::toVariant( arg ).index() == 0 )
+			virtualArgs++;
+
+	cout << "virtually dispatched: " << virtualArgs << endl;
+	cout << "iterations: " << itest.getValue() << endl;
+	cout << "name: " << ntest.getValue() << endl;
+	cout << "count: " << ctest.getValue() << endl;
+	cout << "factor: " << ftest.getValue() << endl;
+	cout << "levels:";
+	for ( const string& level : ltest.getValue() )
+		cout << " " << level;
+	cout << endl;
+	cout << "extra: " << xtest.getValue() << endl;
+	cout << "verbose: " << vtest.getValue() << endl;
+	cout << "quiet: " << qtest.getValue() << " (" << qtest.matches << " matches)" << endl;
+	cout << "files:";
+	for ( const string& file : files.getValue() )
+		cout << " " << file;
+	cout << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
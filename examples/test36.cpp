@@ -0,0 +1,25 @@
+#include <iostream>
+#include "test36_spec.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	try {
+
+	test36::Options opts = test36::parse( argc, argv );
+
+	cout << "iterations: " << opts.iterations << endl;
+	cout << "tag: " << opts.tag << endl;
+	cout << "output: " << opts.output_dir << endl;
+	cout << "levels:";
+	for ( int level : opts.level )
+		cout << " " << level;
+	cout << endl;
+	cout << "extra: " << opts.extra << endl;
+
+	} catch ( TCLAP::ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+	catch ( TCLAP::ExitException& e )
+	{ return e.getExitStatus(); }
+}
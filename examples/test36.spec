@@ -0,0 +1,35 @@
+# Options of test36, turned into test36_spec.h by tclap-gen.
+
+[parser]
+namespace = test36
+struct = Options
+message = Runs the experiments described by the options.
+
+[value iterations]
+flag = i
+type = int
+default = 10
+description = Number of iterations
+
+[value tag]
+flag = t
+type = string
+required = true
+description = Run tag, which is written into the name of every output file that the run produces
+
+[value output-dir]
+flag = o
+type = string
+default = out
+typeDesc = directory
+description = Directory that the output files are written to
+
+[multi level]
+flag = l
+type = int
+typeDesc = level
+description = Levels to run
+
+[switch extra]
+flag = x
+description = Enable extra checks
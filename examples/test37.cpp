@@ -0,0 +1,44 @@
+#define TCLAP_PARSE_STATS
+#include <string>
+#include <vector>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	ParseStats stats;
+
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+	cmd.setExceptionHandling(false);
+	cmd.setParseStats(&stats);
+
+	vector<string> allowed;
+	allowed.push_back("fast");
+	allowed.push_back("slow");
+	ValuesConstraint<string> allowedVals( allowed );
+
+	ValueArg<int> itest("i", "iterations", "Number of iterations", false, 10, "int", cmd);
+	MultiArg<string> mtest("m", "mode", "Modes to run", false, &allowedVals, cmd);
+	SwitchArg<> xtest("x", "extra", "Enable extra checks", cmd);
+	UnlabeledMultiArg<string> files("files", "Input files", false, "file", cmd);
+
+	cmd.parse( argc, argv );
+
+	cout << "iterations: " << itest.getValue() << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+
+	cout << "tokens: " << stats.tokens << endl;
+	cout << "processArg calls: " << stats.processArgCalls << endl;
+	cout << "string comparisons: " << stats.stringComparisons << endl;
+	cout << "conversions: " << stats.conversions << endl;
+	cout << "constraint checks: " << stats.constraintChecks << endl;
+	cout << "exceptions: " << stats.exceptions << endl;
+	cout << "timed: " << (stats.tokenizationNs + stats.matchingNs > 0 ? "yes" : "no") << endl;
+}
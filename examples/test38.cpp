@@ -0,0 +1,38 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	const char* kinds[] = { "matched", "converted", "unmatched" };
+
+	auto sink = makeParseEventSink<char>([&](const ParseEvent<char>& e) {
+		cout << kinds[static_cast<int>(e.kind)] << " "
+			<< (e.arg ? e.arg->getNameView() : string_view("-"))
+			<< " at " << e.tokenIndex << "+" << e.tokenCount
+			<< ": " << e.token << endl;
+	});
+
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+	cmd.setEventSink(&sink);
+
+	ValueArg<int> itest("i", "iterations", "Number of iterations", false, 10, "int", cmd);
+	MultiArg<string> mtest("m", "mode", "Modes to run", false, "mode", cmd);
+	SwitchArg<> xtest("x", "extra", "Enable extra checks", cmd);
+	MultiSwitchArg<> vtest("v", "verbose", "Verbosity", cmd);
+	UnlabeledMultiArg<string> files("files", "Input files", false, "file", cmd);
+
+	cmd.parse( argc, argv );
+
+	cout << "iterations: " << itest.getValue() << endl;
+	cout << "verbose: " << vtest.getValue() << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
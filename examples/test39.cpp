@@ -0,0 +1,39 @@
+#include <string>
+#include <vector>
+#include <iterator>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	MultiArg<string> tags("t", "tag", "Tags to apply", false, "tag", cmd);
+	UnlabeledMultiArg<int> sizes("sizes", "Sizes to add up", true, "int", cmd);
+
+	vector<string> collected;
+	tags.streamTo( back_inserter( collected ) );
+
+	long total = 0;
+	sizes.setValueCallback( [&total](int&& size) {
+		total += size;
+		cout << "size " << size << ", total " << total << endl;
+	});
+
+	cmd.parse( argc, argv );
+
+	cout << "sizes kept: " << sizes.getValue().size() << endl;
+	cout << "sizes streamed: " << sizes.getCount() << endl;
+	cout << "tags:";
+	for ( const string& tag : collected )
+		cout << " " << tag;
+	cout << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
@@ -0,0 +1,29 @@
+#include <clocale>
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	setlocale( LC_ALL, "" );
+
+	try {
+
+	CmdLine<wchar_t> cmd(L"Command description message", L' ', L"0.9");
+
+	ValueArg<wstring, wchar_t> name(L"n", L"name", L"Name to print", true, L"homer", L"string", cmd);
+	UnlabeledMultiArg<wstring, wchar_t> words(L"words", L"Words to print", false, L"word", cmd);
+
+	// The narrow argv is decoded into one arena, not one string at a time.
+	cmd.parse( argc, argv );
+
+	cout << "name: " << StringConvert<wchar_t>::toMBString( name.getValue() ) << endl;
+	for ( const wstring& word : words.getValue() )
+		cout << "word: " << StringConvert<wchar_t>::toMBString( word ) << " (" << word.size() << " chars)" << endl;
+
+	} catch ( ArgException<wchar_t>& e )
+	{ cout << "ERROR: " << StringConvert<wchar_t>::toMBString( e.error() ) << " " << StringConvert<wchar_t>::toMBString( e.argId() ) << endl; }
+}
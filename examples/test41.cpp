@@ -0,0 +1,32 @@
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	ValueArg<string> name("n", "name", "Name to print", true, "homer", "string", cmd);
+	SwitchArg<> reverse("r", "reverse", "Print the name reversed", cmd);
+
+	cmd.parse( argc, argv );
+
+	// The usage is rendered into a buffer that is handed over, instead of
+	// being written to stderr.
+	StdOutput<> output;
+	OutputBuffer<> buffer;
+	output.renderUsage( cmd, buffer );
+	string usage = buffer.release();
+
+	cout << "usage has " << count( usage.begin(), usage.end(), '\n' ) << " lines" << endl;
+	cout << usage.substr( 0, usage.find( "Where:" ) );
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
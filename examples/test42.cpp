@@ -0,0 +1,74 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+static string render( CmdLine<>& cmd )
+{
+	StdOutput<> output;
+	OutputBuffer<> buffer;
+	output.renderUsage( cmd, buffer );
+	return buffer.release();
+}
+
+// Counts how often the usage asks for its ids, which it only does while
+// rendering.
+class CountingSwitch : public SwitchArg<>
+{
+public:
+	using SwitchArg<>::SwitchArg;
+
+	virtual string shortID(const string& valueId) const override
+	{
+		calls++;
+		return SwitchArg<>::shortID(valueId);
+	}
+
+	virtual string longID(const string& valueId) const override
+	{
+		calls++;
+		return SwitchArg<>::longID(valueId);
+	}
+
+	mutable int calls = 0;
+};
+
+int main(int argc, char** argv)
+{
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	ValueArg<string> name("n", "name", "Name to print", true, "homer", "string", cmd);
+	CountingSwitch verbose("v", "verbose", "Print more", cmd);
+
+	cmd.parse( argc, argv );
+
+	// The second usage is served from the cache of the CmdLine.
+	string first = render( cmd );
+	int callsFirst = verbose.calls;
+	string second = render( cmd );
+	int callsSecond = verbose.calls - callsFirst;
+	cout << "cached usage is " << ( first == second ? "the same" : "different" ) << endl;
+	cout << "first usage " << ( callsFirst ? "rendered" : "didn't render" ) << " the ids" << endl;
+	cout << "second usage " << ( callsSecond ? "rendered" : "didn't render" ) << " the ids" << endl;
+
+	// Adding an Arg clears the cache.
+	SwitchArg<> quiet("q", "quiet", "Print nothing", cmd);
+	int callsBefore = verbose.calls;
+	string third = render( cmd );
+	cout << "usage after add " << ( verbose.calls != callsBefore ? "rendered" : "didn't render" ) << " the ids" << endl;
+	cout << "usage after add " << ( third.find( "--quiet" ) != string::npos ? "lists" : "misses" ) << " --quiet" << endl;
+
+	// And so does an xorAdd.
+	SwitchArg<> up("u", "up", "Print in upper case");
+	SwitchArg<> down("d", "down", "Print in lower case");
+	cmd.xorAdd( up, down );
+	string fourth = render( cmd );
+	cout << fourth.substr( 0, fourth.find( "Where:" ) );
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
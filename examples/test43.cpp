@@ -0,0 +1,29 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	// Wrap the usage for a terminal of 50 columns, whatever the output
+	// is going to.
+	TerminalWidth::set(50);
+
+	try {
+
+	CmdLine<> cmd("This message is wrapped to the width of the terminal, which is set to fifty columns here.", ' ', "0.9");
+
+	ValueArg<string> name("n", "name", "Name to print, which is wrapped like every other description of an argument", true, "homer", "string", cmd);
+	ValueArg<int> times("t", "times", "Number of times to print the name", false, 1, "count", cmd);
+	SwitchArg<> reverse("r", "reverse", "Print the name reversed", cmd);
+
+	cmd.parse( argc, argv );
+
+	for ( int i = 0; i < times.getValue(); i++ )
+		cout << "My name is: " << name.getValue() << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
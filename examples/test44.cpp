@@ -0,0 +1,32 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	ValueArg<string> input("i", "input", "File to read", false, "-", "file", cmd);
+	ValueArg<string> output("o", "output", "File to write", false, "-", "file", cmd);
+	SwitchArg<> append("a", "append", "Append to the output file instead of replacing it", cmd);
+	ValueArg<int> level("l", "level", "Compression level", false, 6, "level", cmd);
+	SwitchArg<> verbose("v", "verbose", "Print what is done", cmd);
+
+	// --help files only lists these
+	input.setSection("files");
+	output.setSection("files");
+	append.setSection("files");
+	level.setSection("compression");
+
+	cmd.parse( argc, argv );
+
+	cout << "input: " << input.getValue() << endl;
+
+	} catch ( ArgException<>& e )
+	{ cout << "ERROR: " << e.error() << " " << e.argId() << endl; }
+}
@@ -0,0 +1,43 @@
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// Help text that lives in a static table and is never copied.
+static const char* const descriptions[] = {
+	"Number of iterations",
+	"Enable extra checks",
+};
+
+static int loads = 0;
+
+int main(int argc, char** argv)
+{
+	// Wrap everything in a try block.  Do this every time,
+	// because exceptions will be thrown for problems.
+	try {
+
+	CmdLine<> cmd("Command description message", ' ', "0.9");
+
+	// The description is handed to the constructor, so it is never
+	// copied into the Arg.
+	ValueArg<int> countArg("c","count",Arg<>::DescriptionType::external(descriptions[0]),false,1,"int");
+	cmd.add( countArg );
+
+	// The loader only runs when the description is printed.
+	SwitchArg<> checkSwitch("x","check",[]() { loads++; return string(descriptions[1]); }, false);
+	cmd.add( checkSwitch );
+
+	cmd.parse( argc, argv );
+
+	cout << "loads after parse: " << loads << endl;
+
+	cmd.getOutput()->usage(cmd);
+
+	cout << "loads after usage: " << loads << endl;
+
+	} catch (ArgException<>& e)  // catch any exceptions
+	{ cerr << "error: " << e.error() << " for arg " << e.argId() << endl; }
+}
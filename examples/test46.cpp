@@ -0,0 +1,126 @@
+#include <clocale>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include "tclap/Utf8Transcoder.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// Decodes the input, prints how much was read and the units written,
+// then encodes the units back and prints the bytes.
+template<typename T_Char>
+static void roundTrip(const char* name, const string& in)
+{
+	basic_string<T_Char> units(in.size(), T_Char());
+	size_t size_units = 0;
+	size_t read = Utf8Transcoder<T_Char>::decode(in.data(), in.size(), &units[0], size_units);
+	units.resize(size_units);
+
+	cout << name << " (" << sizeof(T_Char) * 8 << "): read " << read << " of " << in.size() << ":";
+	for ( T_Char c : units )
+		cout << " " << hex << setw(4) << static_cast<unsigned long>(c) << dec;
+	cout << endl;
+
+	string bytes(units.size() * Utf8Transcoder<T_Char>::maxBytesPerChar, '\0');
+	size_t size_bytes = 0;
+	size_t encoded = Utf8Transcoder<T_Char>::encode(units.data(), units.size(), &bytes[0], size_bytes);
+	bytes.resize(size_bytes);
+
+	cout << "  encoded " << encoded << " of " << units.size() << ":";
+	for ( char b : bytes )
+		cout << " " << hex << setw(2) << static_cast<unsigned>(static_cast<unsigned char>(b)) << dec;
+	cout << endl;
+}
+
+// Encodes the units and prints how much was read and the bytes written.
+template<typename T_Char>
+static void encodeOnly(const char* name, const basic_string<T_Char>& in)
+{
+	string bytes(in.size() * Utf8Transcoder<T_Char>::maxBytesPerChar, '\0');
+	size_t size_bytes = 0;
+	size_t read = Utf8Transcoder<T_Char>::encode(in.data(), in.size(), &bytes[0], size_bytes);
+	bytes.resize(size_bytes);
+
+	cout << name << " (" << sizeof(T_Char) * 8 << "): read " << read << " of " << in.size() << ":";
+	for ( char b : bytes )
+		cout << " " << hex << setw(2) << static_cast<unsigned>(static_cast<unsigned char>(b)) << dec;
+	cout << endl;
+}
+
+// Decodes the input a few bytes at a time, carrying what each call leaves
+// unread over to the next, and prints the units written.
+template<typename T_Char>
+static void chunked(const char* name, const string& in, size_t chunk)
+{
+	basic_string<T_Char> units;
+	string pending;
+	for ( size_t pos = 0; pos < in.size(); pos += chunk )
+	{
+		pending += in.substr(pos, chunk);
+		basic_string<T_Char> out(pending.size(), T_Char());
+		size_t size_out = 0;
+		size_t read = Utf8Transcoder<T_Char>::decode(pending.data(), pending.size(), &out[0], size_out);
+		units.append(out, 0, size_out);
+		pending.erase(0, read);
+	}
+
+	cout << name << " (" << sizeof(T_Char) * 8 << ") by " << chunk << ", " << pending.size() << " left:";
+	for ( T_Char c : units )
+		cout << " " << hex << setw(4) << static_cast<unsigned long>(c) << dec;
+	cout << endl;
+}
+
+template<typename T_Char>
+static void run()
+{
+	// Long enough for two blocks of 16 and a tail, with a 2-byte character
+	// that breaks up the second block.
+	roundTrip<T_Char>("ascii", "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFG");
+	roundTrip<T_Char>("ascii break", "abcdefghijklmnopqr\xC3\xA9stuvwxyz0123456789");
+
+	roundTrip<T_Char>("2-byte", "\xC3\xA9");
+	roundTrip<T_Char>("3-byte", "\xE2\x82\xAC");
+	roundTrip<T_Char>("4-byte", "\xF0\x9F\x98\x80");
+	roundTrip<T_Char>("limits", "\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF");
+
+	// One U+FFFD for each byte that doesn't start a valid sequence.
+	roundTrip<T_Char>("continuation", "a\x80" "b");
+	roundTrip<T_Char>("overlong", "\xC0\xAF\xE0\x80\xAF");
+	roundTrip<T_Char>("surrogate", "\xED\xA0\x80");
+	roundTrip<T_Char>("too big", "\xF4\x90\x80\x80\xF5");
+	roundTrip<T_Char>("truncated", "\xE2\x82" "a");
+
+	// An incomplete sequence at the end is left unread.
+	roundTrip<T_Char>("split 2", "ab\xC3");
+	roundTrip<T_Char>("split 3", "ab\xE2\x82");
+	roundTrip<T_Char>("split 4", "ab\xF0\x9F\x98");
+	for ( size_t chunk = 1; chunk <= 3; chunk++ )
+		chunked<T_Char>("chunked", "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "b", chunk);
+	chunked<T_Char>("chunked tail", "ab\xF0\x9F\x98", 2);
+}
+
+int main()
+{
+	cout << uppercase << setfill('0');
+
+	run<char16_t>();
+	run<char32_t>();
+
+	// A high surrogate at the end is left for the next call, unpaired
+	// surrogates elsewhere become U+FFFD.
+	encodeOnly<char16_t>("split pair", u"a\xD83D");
+	encodeOnly<char16_t>("lone high", u"\xD83D" "a");
+	encodeOnly<char16_t>("lone low", u"a\xDE00");
+	encodeOnly<char16_t>("reversed pair", u"\xDE00\xD83D" "a");
+	encodeOnly<char32_t>("lone surrogate", U"\xD800" "a");
+	encodeOnly<char32_t>("too big", U"\x110000" "a");
+
+	// The locale check is cached, but follows the locale when it changes.
+	bool follows = !Utf8Transcoder<char16_t>::isUtf8Locale();
+	if ( setlocale( LC_CTYPE, "C.UTF-8" ) )
+		follows = follows && Utf8Transcoder<char16_t>::isUtf8Locale();
+	setlocale( LC_CTYPE, "C" );
+	follows = follows && !Utf8Transcoder<char16_t>::isUtf8Locale();
+	cout << "locale check follows setlocale: " << (follows ? "yes" : "no") << endl;
+}
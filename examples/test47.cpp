@@ -0,0 +1,100 @@
+#include <clocale>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include "tclap/StringConvert.h"
+
+using namespace TCLAP;
+using namespace std;
+
+// 4094 'a' and a 4-byte character, so that the default buffer of 4096
+// bytes ends in the middle of it, then more of the same.
+static string input()
+{
+	return string(4094, 'a') + "\xF0\x9F\x98\x80" + string(4090, 'b') + "\xF0\x9F\x98\x80" + "c";
+}
+
+template<typename T_Char>
+static basic_string<T_Char> expected()
+{
+	basic_string<T_Char> str(4094, T_Char('a'));
+	if ( sizeof(T_Char) == 2 )
+		str += { T_Char(0xD83D), T_Char(0xDE00) };
+	else
+		str += T_Char(0x1F600);
+	str.append(4090, T_Char('b'));
+	if ( sizeof(T_Char) == 2 )
+		str += { T_Char(0xD83D), T_Char(0xDE00) };
+	else
+		str += T_Char(0x1F600);
+	str += T_Char('c');
+	return str;
+}
+
+// Converts the input a chunk at a time through the restartable overload
+// writing to a buffer, checking each call stays within maxFromMBSize.
+template<typename T_Char>
+static void chunked(const string& in, size_t chunk)
+{
+	using Convert = StringConvert<T_Char>;
+	basic_string<T_Char> str;
+	mbstate_t mbstate{};
+	bool within = true;
+	for ( size_t pos = 0; pos < in.size(); pos += chunk )
+	{
+		string_view part = string_view(in).substr(pos, chunk);
+		size_t size_old = str.size();
+		str.resize(size_old + Convert::maxFromMBSize(part.size()));
+		size_t size_conv = Convert::fromMBStringRestartable(part, mbstate, &str[size_old]);
+		within = within && size_conv <= Convert::maxFromMBSize(part.size());
+		str.resize(size_old + size_conv);
+	}
+
+	cout << "chunks of " << chunk << " (" << sizeof(T_Char) * 8 << "): "
+		 << (str == expected<T_Char>() ? "ok" : "wrong") << ", "
+		 << (within ? "within bound" : "over bound") << endl;
+}
+
+// Reads the input back through ConvertedIstreamBuf and prints the number
+// of characters and the last few.
+template<typename T_Char>
+static void streamed(const char* name, const string& in, size_t size_buffer)
+{
+	stringbuf sb(in);
+	typename StringConvert<T_Char>::ConvertedIstreamBuf buf(&sb, size_buffer);
+	basic_string<T_Char> str;
+	for ( auto c = buf.sbumpc(); c != char_traits<T_Char>::eof(); c = buf.sbumpc() )
+		str += char_traits<T_Char>::to_char_type(c);
+
+	cout << name << " by " << size_buffer << " (" << sizeof(T_Char) * 8 << "): " << str.size() << " chars:" << hex;
+	for ( size_t i = str.size() < 4 ? 0 : str.size() - 4; i < str.size(); i++ )
+		cout << " " << static_cast<unsigned long>(str[i]);
+	cout << dec << endl;
+}
+
+template<typename T_Char>
+static void run()
+{
+	const string in = input();
+	chunked<T_Char>(in, 1);
+	chunked<T_Char>(in, 3);
+	chunked<T_Char>(in, 4096);
+	chunked<T_Char>(in, in.size());
+
+	streamed<T_Char>("lone", "\xF0\x9F\x98\x80", 1);
+	streamed<T_Char>("lone", "\xF0\x9F\x98\x80", 2);
+	streamed<T_Char>("long", in, 1);
+	streamed<T_Char>("long", in, 4096);
+}
+
+int main()
+{
+	if ( !setlocale( LC_CTYPE, "C.UTF-8" ) && !setlocale( LC_CTYPE, "en_US.UTF-8" ) )
+	{
+		cout << "no UTF-8 locale" << endl;
+		return 0;
+	}
+
+	run<char16_t>();
+	run<char32_t>();
+}
@@ -0,0 +1,133 @@
+#include <clocale>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include "tclap/StringConvert.h"
+
+using namespace TCLAP;
+using namespace std;
+
+using Convert = StringConvert<char16_t>;
+using Buf = Convert::ConvertedIstreamBuf;
+
+static void print(const char* name, const u16string& str)
+{
+	cout << name << ": " << str.size() << " chars:" << hex;
+	for ( size_t i = 0; i < str.size() && i < 12; i++ )
+		cout << " " << static_cast<unsigned long>(str[i]);
+	if ( str.size() > 12 )
+		cout << " ...";
+	cout << dec << endl;
+}
+
+static void printChar(const char* name, char_traits<char16_t>::int_type c)
+{
+	if ( c == char_traits<char16_t>::eof() )
+		cout << name << ": eof" << endl;
+	else
+		cout << name << ": " << hex << static_cast<unsigned long>(c) << dec << endl;
+}
+
+int main()
+{
+	if ( !setlocale( LC_CTYPE, "C.UTF-8" ) && !setlocale( LC_CTYPE, "en_US.UTF-8" ) )
+	{
+		cout << "no UTF-8 locale" << endl;
+		return 0;
+	}
+
+	// 2, 3 and 4-byte characters split across refills of every size.
+	const string mixed = "a\xC3\xA9" "b\xE2\x82\xAC" "c\xF0\x9F\x98\x80" "d";
+	for ( size_t size_buffer = 1; size_buffer <= 5; size_buffer++ )
+	{
+		stringbuf sb(mixed);
+		Buf buf(&sb, size_buffer);
+		u16string str;
+		for ( auto c = buf.sbumpc(); c != char_traits<char16_t>::eof(); c = buf.sbumpc() )
+			str += char_traits<char16_t>::to_char_type(c);
+		string name = "refills of " + to_string(size_buffer);
+		print(name.c_str(), str);
+	}
+
+	// underflow doesn't move past the character it returns.
+	{
+		stringbuf sb("xy");
+		Buf buf(&sb, 1);
+		printChar("sgetc", buf.sgetc());
+		printChar("sgetc again", buf.sgetc());
+		printChar("snextc", buf.snextc());
+		printChar("snextc at end", buf.snextc());
+		printChar("sgetc at end", buf.sgetc());
+	}
+
+	// xsgetn, both through the get area and straight into the
+	// destination, which it does for reads larger than a refill.
+	{
+		string in;
+		for ( int i = 0; i < 300; i++ )
+			in += "\xE2\x82\xAC" "a";
+		stringbuf sb(in);
+		Buf buf(&sb, 16);
+		u16string str(3, u'\0');
+		streamsize got = buf.sgetn(&str[0], 3);
+		str.resize(static_cast<size_t>(got));
+		print("small read", str);
+		str.assign(500, u'\0');
+		got = buf.sgetn(&str[0], 500);
+		str.resize(static_cast<size_t>(got));
+		print("bulk read", str);
+		printChar("putback after bulk", buf.sungetc());
+		printChar("again", buf.sbumpc());
+		str.assign(500, u'\0');
+		got = buf.sgetn(&str[0], 500);
+		str.resize(static_cast<size_t>(got));
+		print("rest", str);
+		printChar("putback at end", buf.sungetc());
+	}
+
+	// A bulk read to the end leaves the last characters for putback.
+	{
+		string in = "xy";
+		for ( int i = 0; i < 100; i++ )
+			in += "\xC3\xA9";
+		in += "z";
+		stringbuf sb(in);
+		Buf buf(&sb, 8);
+		printChar("first", buf.sbumpc());
+		u16string str(200, u'\0');
+		streamsize got = buf.sgetn(&str[0], 200);
+		str.resize(static_cast<size_t>(got));
+		print("bulk to end", str);
+		printChar("put back last", buf.sungetc());
+		printChar("put back before", buf.sungetc());
+		printChar("read", buf.sbumpc());
+		printChar("read", buf.sbumpc());
+		printChar("read at end", buf.sbumpc());
+	}
+
+	// Putback keeps the last few characters across refills, and fails
+	// past them.
+	{
+		stringbuf sb("abcdefgh");
+		Buf buf(&sb, 2);
+		for ( int i = 0; i < 6; i++ )
+			buf.sbumpc();
+		printChar("sungetc", buf.sungetc());
+		printChar("sungetc", buf.sungetc());
+		printChar("sputbackc match", buf.sputbackc(u'd'));
+		printChar("sputbackc mismatch", buf.sputbackc(u'z'));
+		printChar("sbumpc", buf.sbumpc());
+		printChar("sbumpc", buf.sbumpc());
+	}
+
+	// A surrogate pair can be put back half at a time.
+	{
+		stringbuf sb("\xF0\x9F\x98\x80" "z");
+		Buf buf(&sb, 1);
+		printChar("high", buf.sbumpc());
+		printChar("low", buf.sbumpc());
+		printChar("put back low", buf.sungetc());
+		printChar("put back high", buf.sungetc());
+		printChar("read high", buf.sbumpc());
+	}
+}
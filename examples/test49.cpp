@@ -0,0 +1,42 @@
+#include <clocale>
+#include <string>
+#include <iostream>
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+	setlocale( LC_CTYPE, "C.UTF-8" );
+
+	try {
+
+	CmdLine<char16_t> cmd(u"Grüße vom Kommandozeilenparser 😀", u' ', u"0.9");
+
+	ValueArg<u16string, char16_t> name(u"n", u"name", u"Name to print, for example Zoë", false, u"homer", u"string", cmd);
+	SwitchArg<char16_t> loud(u"l", u"loud", u"Print the name in capitals ✓", cmd, false);
+
+	cmd.parse( argc, argv );
+
+	cout << "name: " << StringConvert<char16_t>::toMBString( name.getValue() ) << endl;
+
+	// A converted stream starts out good, whether it writes to a stream
+	// buffer or straight to a file descriptor.
+	cout.flush();
+	{
+		StringConvert<char16_t>::ConvertedOstream out(1);
+		const u16string line = u"written to fd 1: " + name.getValue() + u"\n";
+		out.write(line.data(), static_cast<streamsize>(line.size()));
+		out.flush();
+		cout << "fd stream good: " << out.good() << endl;
+	}
+	{
+		StringConvert<char16_t>::ConvertedOstream out(cout.rdbuf());
+		out.put(u'\u2713').put(u'\n').flush();
+		cout << "stream good: " << out.good() << endl;
+	}
+
+	} catch ( ArgException<char16_t>& e )
+	{ cout << "ERROR: " << StringConvert<char16_t>::toMBString( e.error() ) << " " << StringConvert<char16_t>::toMBString( e.argId() ) << endl; }
+}
@@ -38,15 +38,42 @@
 #include <iostream>
 #include <iomanip>
 #include <cstdio>
+#include <array>
+#include <functional>
 
 #include <tclap/UseAllocatorBase.h>
 #include <tclap/StringConvert.h>
+#include <tclap/StringPool.h>
+#include <tclap/ArgDescription.h>
+#include <tclap/ParseStats.h>
+#include <tclap/ParseEvent.h>
 #include <tclap/ArgException.h>
 #include <tclap/Visitor.h>
 #include <tclap/CmdLineInterface.h>
 #include <tclap/ArgTraits.h>
 #include <tclap/StandardTraits.h>
 
+// The start strings of flags and names, see Arg::flagStartChar,
+// Arg::flagStartString and Arg::nameStartString.
+// TCLAP_CUSTOM_START_STRINGS records that one of them was customized.
+#ifndef TCLAP_FLAGSTARTCHAR
+#define TCLAP_FLAGSTARTCHAR '-'
+#else
+#define TCLAP_CUSTOM_START_STRINGS
+#endif
+
+#ifndef TCLAP_FLAGSTARTSTRING
+#define TCLAP_FLAGSTARTSTRING "-"
+#else
+#define TCLAP_CUSTOM_START_STRINGS
+#endif
+
+#ifndef TCLAP_NAMESTARTSTRING
+#define TCLAP_NAMESTARTSTRING "--"
+#else
+#define TCLAP_CUSTOM_START_STRINGS
+#endif
+
 namespace TCLAP {
 
 	class Visitor;
@@ -77,6 +104,9 @@ namespace TCLAP {
 		using ArgListIteratorType = typename ArgListType::const_iterator;
 		using ArgVectorIteratorType = typename ArgVectorType::const_iterator;
 		using CmdLineInterfaceType = CmdLineInterface<T_Char, T_CharTraits, T_Alloc>;
+		using StringPoolType = StringPool<T_Char, T_CharTraits, T_Alloc>;
+		using DescriptionType = ArgDescription<T_Char, T_CharTraits, T_Alloc>;
+		using DescriptionLoaderType = typename DescriptionType::LoaderType;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -121,34 +151,36 @@ namespace TCLAP {
 		 * The char that indicates the beginning of a flag.  Defaults to '-', but
 		 * clients can define TCLAP_FLAGSTARTCHAR to override.
 		 */
-#ifndef TCLAP_FLAGSTARTCHAR
-#define TCLAP_FLAGSTARTCHAR '-'
-#endif
-		static CharType flagStartChar() { return StringConvertType::fromConstBasicChar(TCLAP_FLAGSTARTCHAR); }
+		static constexpr CharType flagStartChar() { return StringConvertType::fromConstBasicChar(TCLAP_FLAGSTARTCHAR); }
 
 		/**
 		 * The sting that indicates the beginning of a flag.  Defaults to "-", but
 		 * clients can define TCLAP_FLAGSTARTSTRING to override. Should be the same
 		 * as TCLAP_FLAGSTARTCHAR.
 		 */
-#ifndef TCLAP_FLAGSTARTSTRING
-#define TCLAP_FLAGSTARTSTRING "-"
-#endif
-		static const StringType flagStartString() { return StringConvertType::fromConstBasicCharString(TCLAP_FLAGSTARTSTRING); }
+		static constexpr StringViewType flagStartString() { return StringConvertType::template constBasicString<TCLAP_FLAGSTARTSTRING>(); }
 
 		/**
 		 * The sting that indicates the beginning of a name.  Defaults to "--", but
 		 *  clients can define TCLAP_NAMESTARTSTRING to override.
 		 */
-#ifndef TCLAP_NAMESTARTSTRING
-#define TCLAP_NAMESTARTSTRING "--"
-#endif
-		static const StringType nameStartString() { return StringConvertType::fromConstBasicCharString(TCLAP_NAMESTARTSTRING); }
+		static constexpr StringViewType nameStartString() { return StringConvertType::template constBasicString<TCLAP_NAMESTARTSTRING>(); }
 
 		/**
 		 * The name used to identify the ignore rest argument.
 		 */
-		static const StringType ignoreNameString() { return StringConvertType::fromConstBasicCharString("ignore_rest"); }
+		static constexpr StringViewType ignoreNameString() { return StringConvertType::template constBasicString<"ignore_rest">(); }
+
+		/**
+		 * The label shown in the usage of required arguments.
+		 */
+		static constexpr StringViewType requiredLabel() { return StringConvertType::template constBasicString<"required">(); }
+
+		/**
+		 * The label shown in the usage of arguments that are required as
+		 * part of an xor.
+		 */
+		static constexpr StringViewType xorRequiredLabel() { return StringConvertType::template constBasicString<"OR required">(); }
 
 		/**
 		 * Sets the delimiter for all arguments.
@@ -177,11 +209,21 @@ namespace TCLAP {
 		 */
 		const StringType& getFlag() const;
 
+		/**
+		 * Returns the argument flag as a view.
+		 */
+		StringViewType getFlagView() const;
+
 		/**
 		 * Returns the argument name.
 		 */
 		const StringType& getName() const;
 
+		/**
+		 * Returns the argument name as a view.
+		 */
+		StringViewType getNameView() const;
+
 		/**
 		 * Returns the argument description.
 		 */
@@ -272,6 +314,53 @@ namespace TCLAP {
 		 */
 		void setRequireLabel(const StringType& s);
 
+		/**
+		 * Sets the requireLabel without copying it.  Used by CmdLine
+		 * for its static labels.
+		 * \param s - Set the requireLabel to this value.  Must outlive
+		 * the Arg.
+		 */
+		void setStaticRequireLabel(StringViewType s);
+
+		/**
+		 * Replaces the description with text that is not copied.  Meant
+		 * for string literals and static string tables.
+		 * \param desc - The description.  Must outlive the Arg.
+		 */
+		void setDescription(StringViewType desc);
+
+		/**
+		 * Replaces the description with a loader that produces it.  The
+		 * loader is only called when the description is needed, which
+		 * is normally only by the output classes, so large or compressed
+		 * help text costs nothing on runs that do not print it.
+		 * \param loader - Called each time the description is needed.
+		 */
+		void setDescription(DescriptionLoaderType loader);
+
+		/**
+		 * Puts the Arg in a section of the help, so that --help=section
+		 * only lists the Args of that section.  The section is not
+		 * copied, like setDescription(StringViewType).
+		 * \param section - The name of the section.  Must outlive the
+		 * Arg.
+		 */
+		void setSection(StringViewType section);
+
+		/**
+		 * Returns the section of the help the Arg is in, which is empty
+		 * unless setSection was called.
+		 */
+		StringViewType getSection() const;
+
+		/**
+		 * Moves the description and the requireLabel into pool and
+		 * releases the Arg's own copies of them.  Used by CmdLine.  Afterwards the pool must outlive
+		 * every use of this Arg.
+		 * \param pool - The pool to intern the strings into.
+		 */
+		void internStrings(StringPoolType& pool);
+
 		/**
 		 * Used for MultiArgs and XorHandler to determine whether args
 		 * can still be set.
@@ -291,6 +380,12 @@ namespace TCLAP {
 		virtual void reset();
 
 	protected:
+		/**
+		 * Storage for the description.  Emptied once the description
+		 * has been interned into a StringPool.
+		 */
+		StringType _text;
+
 		/**
 		 * The single char flag used to identify the argument.
 		 * This value (preceded by a dash {-}), can be used to identify
@@ -313,7 +408,18 @@ namespace TCLAP {
 		/**
 		 * Description of the argument.
 		 */
-		StringType _description;
+		StringViewType _description;
+
+		/**
+		 * Produces the description, if one was supplied that way.
+		 */
+		DescriptionLoaderType _descriptionLoader;
+
+		/**
+		 * Whether _description refers to text that is not owned by the
+		 * Arg and so needs no interning.
+		 */
+		bool _descriptionExternal;
 
 		/**
 		 * Indicating whether the argument is required.
@@ -322,9 +428,22 @@ namespace TCLAP {
 
 		/**
 		 * Label to be used in usage description.  Normally set to
-		 * "required", but can be changed when necessary.
+		 * "required", but can be changed when necessary.  Refers to
+		 * static storage, so it is shared by all Args, unless it was
+		 * set by copy.
+		 */
+		StringViewType _requireLabel;
+
+		/**
+		 * Storage for a requireLabel set by copy.  Emptied once it has
+		 * been interned into a StringPool.
 		 */
-		StringType _requireLabel;
+		StringType _requireLabelText;
+
+		/**
+		 * The section of the help the Arg is in, or empty.
+		 */
+		StringViewType _section;
 
 		/**
 		 * Indicates whether a value is required for the argument.
@@ -366,6 +485,11 @@ namespace TCLAP {
 		 */
 		void _checkWithVisitor() const;
 
+		/**
+		 * Appends the delimiter and "<valueId>" to id.
+		 */
+		static void _appendValueId(StringType& id, const StringType& valueId);
+
 		/**
 		 * Primary constructor. YOU (yes you) should NEVER construct an Arg
 		 * directly, this is a base class that is extended by various children
@@ -375,13 +499,14 @@ namespace TCLAP {
 		 * \param flag - The flag identifying the argument.
 		 * \param name - The name identifying the argument.
 		 * \param desc - The description of the argument, used in the usage.
+		 * Either text to copy, DescriptionType::external text or a loader.
 		 * \param req - Whether the argument is required.
 		 * \param valreq - Whether the a value is required for the argument.
 		 * \param v - The visitor checked by the argument. Defaults to nullptr.
 		 */
 		Arg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			bool valreq,
 			Visitor* v = nullptr,
@@ -432,7 +557,7 @@ namespace TCLAP {
 
 		std::size_t valuesRead = 0;
 		while (is.good()) {
-			if (is.peek() != EOF)
+			if (!T_CharTraits::eq_int_type(is.peek(), T_CharTraits::eof()))
 #ifdef TCLAP_SETBASE_ZERO
 				is >> std::setbase(0) >> destVal;
 #else
@@ -472,17 +597,22 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline Arg<T_Char, T_CharTraits, T_Alloc>::Arg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		bool valreq,
 		Visitor* v,
 		const AllocatorType& alloc) :
 		UseAllocatorBase<T_Alloc>(alloc),
-		_flag(flag),
-		_name(name),
-		_description(desc),
+		_text(desc.isCopied() ? desc.text() : StringViewType(), alloc),
+		_flag(flag, alloc),
+		_name(name, alloc),
+		_description(desc.isCopied() ? StringViewType(_text) : desc.text()),
+		_descriptionLoader(desc.loader()),
+		_descriptionExternal(!desc.isCopied()),
 		_required(req),
-		_requireLabel(StringConvertType::fromConstBasicCharString("required")),
+		_requireLabel(requiredLabel()),
+		_requireLabelText(alloc),
+		_section(),
 		_valueRequired(valreq),
 		_alreadySet(false),
 		_visitor(v),
@@ -494,22 +624,22 @@ namespace TCLAP {
 		if (_name != ignoreNameString() &&
 			(_flag == Arg::flagStartString() ||
 				_flag == Arg::nameStartString() ||
-				_flag == StringConvertType::fromConstBasicCharString(" ")))
+				_flag == StringConvertType::template constBasicString<" ">()))
 			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
 				StringConvertType::fromConstBasicCharString("Argument flag cannot be either '") +
-				Arg::flagStartString() + StringConvertType::fromConstBasicCharString("' or '") +
-				Arg::nameStartString() + StringConvertType::fromConstBasicCharString("' or a space."),
+				StringType(Arg::flagStartString()) + StringConvertType::fromConstBasicCharString("' or '") +
+				StringType(Arg::nameStartString()) + StringConvertType::fromConstBasicCharString("' or a space."),
 				toString()
 				));
 
 		if (
 			_name.starts_with(Arg::flagStartString()) ||
 			_name.starts_with(Arg::nameStartString()) ||
-			(_name.find(StringConvertType::fromConstBasicCharString(" "), 0) != StringType::npos))
+			(_name.find(StringConvertType::fromConstBasicChar(' '), 0) != StringType::npos))
 			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
 				StringConvertType::fromConstBasicCharString("Argument name begin with either '") +
-				Arg::flagStartString() + StringConvertType::fromConstBasicCharString("' or '") +
-				Arg::nameStartString() + StringConvertType::fromConstBasicCharString("' or space."),
+				StringType(Arg::flagStartString()) + StringConvertType::fromConstBasicCharString("' or '") +
+				StringType(Arg::nameStartString()) + StringConvertType::fromConstBasicCharString("' or space."),
 				toString()
 				));
 
@@ -522,16 +652,21 @@ namespace TCLAP {
 	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& valueId) const -> StringType {
 		StringType id;
 
-		if (!_flag.empty())
-			id = Arg::flagStartString() + _flag;
-		else
-			id = Arg::nameStartString() + _name;
+		if (!_flag.empty()) {
+			id = Arg::flagStartString();
+			id += _flag;
+		} else {
+			id = Arg::nameStartString();
+			id += _name;
+		}
 
 		if (_valueRequired)
-			id += StringType(1, Arg::delimiter()) + StringConvertType::fromConstBasicCharString("<") + valueId + StringConvertType::fromConstBasicCharString(">");
+			_appendValueId(id, valueId);
 
-		if (!_required)
-			id = StringConvertType::fromConstBasicCharString("[") + id + StringConvertType::fromConstBasicCharString("]");
+		if (!_required) {
+			id.insert(id.begin(), StringConvertType::fromConstBasicChar('['));
+			id += StringConvertType::fromConstBasicChar(']');
+		}
 
 		return id;
 	}
@@ -541,18 +676,20 @@ namespace TCLAP {
 		StringType id;
 
 		if (!_flag.empty()) {
-			id += Arg::flagStartString() + _flag;
+			id += Arg::flagStartString();
+			id += _flag;
 
 			if (_valueRequired)
-				id += StringType(1, Arg::delimiter()) + StringConvertType::fromConstBasicCharString("<") + valueId + StringConvertType::fromConstBasicCharString(">");
+				_appendValueId(id, valueId);
 
-			id += StringConvertType::fromConstBasicCharString(",  ");
+			id += StringConvertType::template constBasicString<",  ">();
 		}
 
-		id += Arg::nameStartString() + _name;
+		id += Arg::nameStartString();
+		id += _name;
 
 		if (_valueRequired)
-			id += StringType(1, Arg::delimiter()) + StringConvertType::fromConstBasicCharString("<") + valueId + StringConvertType::fromConstBasicCharString(">");
+			_appendValueId(id, valueId);
 
 		return id;
 
@@ -569,22 +706,34 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getDescription() const -> StringType {
 		StringType desc;
-		if (_required)
-			desc = StringConvertType::fromConstBasicCharString("(") + _requireLabel + StringConvertType::fromConstBasicCharString(")  ");
+		if (_required) {
+			desc = StringConvertType::fromConstBasicChar('(');
+			desc += _requireLabel;
+			desc += StringConvertType::template constBasicString<")  ">();
+		}
 
 		//	if ( _valueRequired )
 		//		desc += StringConvertType::fromConstBasicCharString("(value required)  ");
 
-		desc += _description;
+		if (_descriptionLoader)
+			desc += _descriptionLoader();
+		else
+			desc += _description;
 		return desc;
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getFlag() const -> const StringType& { return _flag; }
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getFlagView() const -> StringViewType { return _flag; }
+
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getName() const -> const StringType& { return _name; }
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getNameView() const -> StringViewType { return _name; }
+
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline bool Arg<T_Char, T_CharTraits, T_Alloc>::isRequired() const { return _required; }
 
@@ -604,13 +753,57 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void Arg<T_Char, T_CharTraits, T_Alloc>::setRequireLabel(const StringType& s) {
+		_requireLabelText = s;
+		_requireLabel = _requireLabelText;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::setStaticRequireLabel(StringViewType s) {
 		_requireLabel = s;
+		StringType(getAlloc()).swap(_requireLabelText);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::internStrings(StringPoolType& pool) {
+		if (!_descriptionExternal)
+			_description = pool.intern(_description);
+		StringType(getAlloc()).swap(_text);
+		if (!_requireLabelText.empty()) {
+			_requireLabel = pool.intern(_requireLabel);
+			StringType(getAlloc()).swap(_requireLabelText);
+		}
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::setDescription(StringViewType desc) {
+		_description = desc;
+		_descriptionLoader = nullptr;
+		_descriptionExternal = true;
 	}
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::setDescription(DescriptionLoaderType loader) {
+		_description = StringViewType();
+		_descriptionLoader = std::move(loader);
+		_descriptionExternal = true;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::setSection(StringViewType section) {
+		_section = section;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::getSection() const -> StringViewType { return _section; }
+
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline bool Arg<T_Char, T_CharTraits, T_Alloc>::argMatches(const StringType& argFlag) const {
-		if ((argFlag == Arg::flagStartString() + _flag && !_flag.empty()) ||
-			argFlag == Arg::nameStartString() + _name)
+		StringViewType sv(argFlag);
+		constexpr StringViewType strFlagStart = Arg::flagStartString();
+		constexpr StringViewType strNameStart = Arg::nameStartString();
+		TCLAP_PARSE_STATS_COUNT(stringComparisons, _flag.empty() ? 1 : 2);
+		if ((!_flag.empty() && sv.size() == strFlagStart.size() + _flag.size() && sv.starts_with(strFlagStart) && sv.ends_with(_flag)) ||
+			(sv.size() == strNameStart.size() + _name.size() && sv.starts_with(strNameStart) && sv.ends_with(_name)))
 			return true;
 		else
 			return false;
@@ -620,10 +813,16 @@ namespace TCLAP {
 	inline auto Arg<T_Char, T_CharTraits, T_Alloc>::toString() const -> StringType {
 		StringType s;
 
-		if (!_flag.empty())
-			s += Arg::flagStartString() + _flag + StringConvertType::fromConstBasicCharString(" ");
+		if (!_flag.empty()) {
+			s += Arg::flagStartString();
+			s += _flag;
+			s += StringConvertType::fromConstBasicChar(' ');
+		}
 
-		s += StringConvertType::fromConstBasicCharString("(") + Arg::nameStartString() + _name + StringConvertType::fromConstBasicCharString(")");
+		s += StringConvertType::fromConstBasicChar('(');
+		s += Arg::nameStartString();
+		s += _name;
+		s += StringConvertType::fromConstBasicChar(')');
 
 		return s;
 	}
@@ -634,6 +833,14 @@ namespace TCLAP {
 			_visitor->visit();
 	}
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void Arg<T_Char, T_CharTraits, T_Alloc>::_appendValueId(StringType& id, const StringType& valueId) {
+		id += Arg::delimiter();
+		id += StringConvertType::fromConstBasicChar('<');
+		id += valueId;
+		id += StringConvertType::fromConstBasicChar('>');
+	}
+
 	/**
 	 * Implementation of trimFlag.
 	 */
@@ -0,0 +1,102 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ArgDescription.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_ARGDESCRIPTION_H
+#define TCLAP_ARGDESCRIPTION_H
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace TCLAP {
+	/**
+	 * The description handed to the constructor of an Arg.  It is either
+	 * text that the Arg copies, text that the caller keeps alive and the
+	 * Arg only refers to, or a loader that produces the text when it is
+	 * needed.  An ArgDescription does not own anything, so it is only
+	 * meant to be created in the argument list of a constructor.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class ArgDescription {
+	public:
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using LoaderType = std::function<StringType()>;
+
+		/**
+		 * Text that is copied by the Arg.
+		 * \param desc - The description.
+		 */
+		ArgDescription(const StringType& desc) : _text(desc), _loader(), _copy(true) {}
+
+		/**
+		 * Text that is copied by the Arg.
+		 * \param desc - The description.
+		 */
+		ArgDescription(const CharType* desc) : _text(desc), _loader(), _copy(true) {}
+
+		/**
+		 * A loader that the Arg calls whenever the description is asked
+		 * for.
+		 * \param loader - Produces the description.
+		 */
+		template<typename T_Loader>
+			requires (std::is_invocable_r_v<StringType, T_Loader&> && !std::is_convertible_v<const T_Loader&, StringViewType>)
+		ArgDescription(T_Loader loader) : _text(), _loader(std::move(loader)), _copy(false) {}
+
+		/**
+		 * Text that is not copied, such as a literal or a static table.
+		 * It must outlive the Arg.
+		 * \param desc - The description.
+		 */
+		static ArgDescription external(StringViewType desc) { return ArgDescription(desc, false); }
+
+		/**
+		 * Whether the Arg should keep a copy of text().
+		 */
+		bool isCopied() const { return _copy; }
+
+		/**
+		 * The text of the description.  Empty for a loader.
+		 */
+		StringViewType text() const { return _text; }
+
+		/**
+		 * The loader, if the description was given as one.
+		 */
+		const LoaderType& loader() const { return _loader; }
+
+	private:
+		ArgDescription(StringViewType desc, bool copy) : _text(desc), _loader(), _copy(copy) {}
+
+		StringViewType _text;
+		LoaderType _loader;
+		bool _copy;
+	};
+}
+
+#endif
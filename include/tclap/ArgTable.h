@@ -0,0 +1,640 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ArgTable.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_ARG_TABLE_H
+#define TCLAP_ARG_TABLE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <span>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <tclap/StringConvert.h>
+#include <tclap/StringPool.h>
+#include <tclap/Arg.h>
+#include <tclap/ValueArg.h>
+#include <tclap/SwitchArg.h>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class ArgTable;
+
+	/**
+	 * A table of optional ValueArgs and SwitchArgs that are described by
+	 * compact descriptors rather than constructed up front.  The real Arg
+	 * for an entry is only constructed when its flag or name is seen on
+	 * the command line, or when its value is queried.  Meant for very
+	 * large generated specs of which a typical run uses only a few
+	 * entries.  The table is added to a CmdLine as a single Arg.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class ArgTable : public Arg<T_Char, T_CharTraits, T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using typename UseAllocatorBase<T_Alloc>::AllocatorTraitsType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CharType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CharTraitsType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgVectorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListIteratorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgVectorIteratorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+		using UseAllocatorBase<T_Alloc>::rebindAlloc;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::addToList;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::beginIgnoring;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::ignoreRest;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::delimiter;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::blankChar;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::flagStartChar;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::flagStartString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::nameStartString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::ignoreNameString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::setDelimiter;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::processArg;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::operator==;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getFlag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getName;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getDescription;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::setDescription;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::forceRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::xorSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isValueRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isIgnoreable;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::argMatches;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::toString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::shortID;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::longID;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::trimFlag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_hasBlanks;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::setRequireLabel;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::allowMore;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::acceptsMultipleValues;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::reset;
+
+		struct Descriptor;
+
+		/**
+		 * Constructs the real Arg for a descriptor.
+		 */
+		using MakeArgType = std::unique_ptr<ArgType>(*)(const Descriptor& d, const AllocatorType& alloc);
+
+		/**
+		 * Describes one entry of the table.  All strings are views, so
+		 * the text they refer to must outlive the table.  Normally a
+		 * descriptor refers to string literals in a static array.
+		 */
+		struct Descriptor {
+			/**
+			 * The one character flag, may be empty.
+			 */
+			StringViewType flag;
+
+			/**
+			 * The name of the entry.
+			 */
+			StringViewType name;
+
+			/**
+			 * The description used in the usage.
+			 */
+			StringViewType desc;
+
+			/**
+			 * The default value, in the same form as on the command line.
+			 * Empty for a value-initialized default.
+			 */
+			StringViewType def;
+
+			/**
+			 * The type description used in the usage.  Empty for switches.
+			 */
+			StringViewType typeDesc;
+
+			/**
+			 * Constructs the real Arg.
+			 */
+			MakeArgType make;
+		};
+
+		/**
+		 * Constructs the ValueArg<T> for a descriptor.  This is the kind
+		 * of the descriptors returned by value<T>().
+		 */
+		template<class T>
+		static std::unique_ptr<ArgType> makeValueArg(const Descriptor& d, const AllocatorType& alloc);
+
+		/**
+		 * Constructs the SwitchArg for a descriptor.  This is the kind of
+		 * the descriptors returned by switchArg().
+		 */
+		static std::unique_ptr<ArgType> makeSwitchArg(const Descriptor& d, const AllocatorType& alloc);
+
+		/**
+		 * Returns a descriptor for a ValueArg<T>.
+		 */
+		template<class T>
+		static constexpr Descriptor value(StringViewType flag, StringViewType name, StringViewType desc, StringViewType def, StringViewType typeDesc) {
+			return Descriptor{ flag, name, desc, def, typeDesc, &makeValueArg<T> };
+		}
+
+		/**
+		 * Returns a descriptor for a SwitchArg.
+		 */
+		static constexpr Descriptor switchArg(StringViewType flag, StringViewType name, StringViewType desc) {
+			return Descriptor{ flag, name, desc, StringViewType(), StringViewType(), &makeSwitchArg };
+		}
+
+		/**
+		 * ArgTable constructor.
+		 * \param name - A one word name for the table.  Note that this is used for
+		 * identification, not as a long flag.
+		 * \param desc - A description of the table, shown ahead of its
+		 * entries in the usage.
+		 * \param parser - A CmdLine parser object to add this Arg to.
+		 */
+		ArgTable(const StringType& name,
+			const StringType& desc,
+			CmdLineInterfaceType& parser,
+			const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Adds entries to the table.  Throws a SpecificationException if
+		 * a flag or name is already in the table or used by another Arg
+		 * of the CmdLine.
+		 * \param descriptors - The entries to be added.
+		 */
+		void add(std::span<const Descriptor> descriptors);
+
+		/**
+		 * Adds entries to the table together with an index of them, such
+		 * as the one stored by ArgTableImage, so that the table does not
+		 * have to build one.  Throws a SpecificationException if the
+		 * index is not sorted or does not cover the entries, or if a flag
+		 * or name is already in the table or used by another Arg of the
+		 * CmdLine.
+		 * \param descriptors - The entries to be added.
+		 * \param byName - The positions in descriptors of all entries,
+		 * ordered by name.  Must outlive the table.
+		 * \param byFlag - The positions in descriptors of the entries
+		 * that have a flag, ordered by flag.  Must outlive the table.
+		 */
+		void add(std::span<const Descriptor> descriptors,
+			std::span<const std::uint32_t> byName,
+			std::span<const std::uint32_t> byFlag);
+
+		/**
+		 * Returns the Arg for an entry, constructing it if necessary.
+		 * Throws a SpecificationException if there is no such entry.
+		 * \param name - The name of the entry.
+		 */
+		ArgType& getArg(StringViewType name);
+
+		/**
+		 * Returns the value of a ValueArg<T> entry.
+		 * \param name - The name of the entry.
+		 */
+		template<class T>
+		const T& getValue(StringViewType name);
+
+		/**
+		 * Returns the value of a SwitchArg entry.
+		 * \param name - The name of the entry.
+		 */
+		bool getSwitch(StringViewType name);
+
+		/**
+		 * Returns the number of entries in the table.
+		 */
+		std::size_t count() const { return _descriptors.size(); }
+
+		/**
+		 * Returns the number of entries whose Arg has been constructed.
+		 */
+		std::size_t countMaterialized() const;
+
+		/**
+		 * Handles the processing of the argument.  Looks up the flag or
+		 * name in the table and hands the arg to the entry's Arg.
+		 * \param idx_arg - Pointer the the current argument in the list.
+		 * \param args - Mutable list of strings. Passed
+		 * in from main().
+		 */
+		virtual bool processArg(std::size_t& idx_arg, StringVectorType& args) override;
+
+		/**
+		 * Overrides shortID for specific behavior.
+		 */
+		virtual StringType shortID(const StringType& val = StringConvertType::fromConstBasicCharString("val")) const override;
+
+		/**
+		 * Overrides longID for specific behavior.
+		 */
+		virtual StringType longID(const StringType& val = StringConvertType::fromConstBasicCharString("val")) const override;
+
+		virtual void reset() override;
+
+	protected:
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_flag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_name;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_description;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_required;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_requireLabel;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_valueRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_alreadySet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_visitor;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_ignoreable;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_xorSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_acceptsMultipleValues;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_checkWithVisitor;
+
+		using IndexMapType = std::unordered_map<StringViewType, std::size_t, StringHash<T_Char, T_CharTraits>, std::equal_to<StringViewType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::pair<const StringViewType, std::size_t>>>;
+		using KeySetType = std::unordered_set<StringViewType, StringHash<T_Char, T_CharTraits>, std::equal_to<StringViewType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<StringViewType>>;
+
+		/**
+		 * The CmdLine the table was added to.
+		 */
+		CmdLineInterfaceType* _parser;
+
+		/**
+		 * The entries of the table.
+		 */
+		std::vector<Descriptor, typename std::allocator_traits<AllocatorType>::template rebind_alloc<Descriptor>> _descriptors;
+
+		/**
+		 * The constructed Args, parallel to _descriptors.  Null until the
+		 * entry is used.
+		 */
+		std::vector<std::unique_ptr<ArgType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::unique_ptr<ArgType>>> _args;
+
+		/**
+		 * Indices of the entries, by flag.
+		 */
+		IndexMapType _byFlag;
+
+		/**
+		 * Indices of the entries, by name.
+		 */
+		IndexMapType _byName;
+
+		/**
+		 * A run of entries that was added together with a sorted index,
+		 * and is not in _byFlag or _byName.
+		 */
+		struct SortedRange {
+			/**
+			 * The index of the first entry of the run.
+			 */
+			std::size_t first;
+
+			/**
+			 * Positions within the run, ordered by name.
+			 */
+			std::span<const std::uint32_t> byName;
+
+			/**
+			 * Positions within the run of the entries with a flag,
+			 * ordered by flag.
+			 */
+			std::span<const std::uint32_t> byFlag;
+		};
+
+		/**
+		 * The runs of entries that were added with a sorted index.
+		 */
+		std::vector<SortedRange, typename std::allocator_traits<AllocatorType>::template rebind_alloc<SortedRange>> _sorted;
+
+		/**
+		 * Returned by _find when there is no such entry.
+		 */
+		static constexpr std::size_t _npos = static_cast<std::size_t>(-1);
+
+		/**
+		 * Returns the index of the entry whose key is s, looking in map
+		 * and in the sorted runs, or _npos.
+		 */
+		std::size_t _find(const IndexMapType& map,
+			std::span<const std::uint32_t> SortedRange::* byKey,
+			StringViewType Descriptor::* key,
+			StringViewType s) const;
+
+		/**
+		 * Returns the index of the entry with the given name, or _npos.
+		 */
+		std::size_t _findName(StringViewType name) const { return _find(_byName, &SortedRange::byName, &Descriptor::name, name); }
+
+		/**
+		 * Returns the index of the entry with the given flag, or _npos.
+		 */
+		std::size_t _findFlag(StringViewType flag) const { return _find(_byFlag, &SortedRange::byFlag, &Descriptor::flag, flag); }
+
+		/**
+		 * Returns the Arg for the entry at index, constructing it if
+		 * necessary.
+		 */
+		ArgType& _materialize(std::size_t index);
+
+		/**
+		 * Throws a SpecificationException if the flag or name of one of
+		 * the descriptors is used by another Arg of _parser.
+		 */
+		void _checkParser(std::span<const Descriptor> descriptors) const;
+
+		/**
+		 * Lists the entries, for the usage.
+		 */
+		StringType _describeEntries() const;
+
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN ArgTable.cpp
+	//////////////////////////////////////////////////////////////////////
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline ArgTable<T_Char, T_CharTraits, T_Alloc>::ArgTable(const StringType& name,
+		const StringType& desc,
+		CmdLineInterfaceType& parser,
+		const AllocatorType& alloc)
+		: Arg<T_Char, T_CharTraits, T_Alloc>(StringType(), name, [this, desc]() { return desc + _describeEntries(); }, false, false, nullptr, alloc),
+		_parser(&parser),
+		_descriptors(alloc),
+		_args(alloc),
+		_byFlag(alloc),
+		_byName(alloc),
+		_sorted(alloc) {
+		// The description loader holds the only copy of desc, and only
+		// lists the entries when the usage is printed.
+		parser.add(this);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTable<T_Char, T_CharTraits, T_Alloc>::add(std::span<const Descriptor> descriptors) {
+		_checkParser(descriptors);
+		_descriptors.reserve(_descriptors.size() + descriptors.size());
+		_args.reserve(_args.size() + descriptors.size());
+		for (const Descriptor& d : descriptors) {
+			if (d.flag.size() > 1)
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument flag can only be one character long"), StringType(d.name)));
+			if ((!d.flag.empty() && _findFlag(d.flag) != _npos) || _findName(d.name) != _npos)
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"), StringType(d.name)));
+
+			std::size_t index = _descriptors.size();
+			_descriptors.push_back(d);
+			_args.emplace_back();
+			if (!d.flag.empty())
+				_byFlag.emplace(d.flag, index);
+			_byName.emplace(d.name, index);
+		}
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTable<T_Char, T_CharTraits, T_Alloc>::add(std::span<const Descriptor> descriptors,
+		std::span<const std::uint32_t> byName,
+		std::span<const std::uint32_t> byFlag) {
+		// A strictly ascending index of the right length lists every
+		// entry exactly once, and proves that the keys are unique.
+		std::size_t countFlags = 0;
+		for (const Descriptor& d : descriptors) {
+			if (d.flag.size() > 1)
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument flag can only be one character long"), StringType(d.name)));
+			if (!d.flag.empty())
+				countFlags++;
+		}
+		if (byName.size() != descriptors.size() || byFlag.size() != countFlags)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Index does not cover the entries of the table"), _name));
+		for (std::size_t i = 0; i < byName.size(); i++)
+			if (byName[i] >= descriptors.size() || (i > 0 && !(descriptors[byName[i - 1]].name < descriptors[byName[i]].name)))
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Index of the entries is not sorted by name"), _name));
+		for (std::size_t i = 0; i < byFlag.size(); i++)
+			if (byFlag[i] >= descriptors.size() || descriptors[byFlag[i]].flag.empty() || (i > 0 && !(descriptors[byFlag[i - 1]].flag < descriptors[byFlag[i]].flag)))
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Index of the entries is not sorted by flag"), _name));
+
+		_checkParser(descriptors);
+
+		// Only entries that were already in the table need a lookup.
+		if (!_descriptors.empty())
+			for (const Descriptor& d : descriptors)
+				if ((!d.flag.empty() && _findFlag(d.flag) != _npos) || _findName(d.name) != _npos)
+					throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"), StringType(d.name)));
+
+		_sorted.push_back(SortedRange{ _descriptors.size(), byName, byFlag });
+		_descriptors.insert(_descriptors.end(), descriptors.begin(), descriptors.end());
+		_args.resize(_descriptors.size());
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTable<T_Char, T_CharTraits, T_Alloc>::_checkParser(std::span<const Descriptor> descriptors) const {
+		// The keys of the other Args are gathered once, so that a large
+		// table is checked in linear time.
+		KeySetType flags(getAlloc());
+		KeySetType names(getAlloc());
+		for (const ArgType* const& arg : _parser->getArgList()) {
+			if (arg == this)
+				continue;
+			if (!arg->getFlag().empty())
+				flags.insert(arg->getFlag());
+			names.insert(arg->getName());
+		}
+		for (const Descriptor& d : descriptors)
+			if ((!d.flag.empty() && flags.contains(d.flag)) || names.contains(d.name))
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"), StringType(d.name)));
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t ArgTable<T_Char, T_CharTraits, T_Alloc>::_find(const IndexMapType& map,
+		std::span<const std::uint32_t> SortedRange::* byKey,
+		StringViewType Descriptor::* key,
+		StringViewType s) const {
+		typename IndexMapType::const_iterator it = map.find(s);
+		if (it != map.end())
+			return it->second;
+		for (const SortedRange& range : _sorted) {
+			std::span<const std::uint32_t> index = range.*byKey;
+			const Descriptor* descriptors = _descriptors.data() + range.first;
+			typename std::span<const std::uint32_t>::iterator pos = std::lower_bound(index.begin(), index.end(), s,
+				[descriptors, key](std::uint32_t i, StringViewType s) { return descriptors[i].*key < s; });
+			if (pos != index.end() && descriptors[*pos].*key == s)
+				return range.first + *pos;
+		}
+		return _npos;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::_materialize(std::size_t index) -> ArgType& {
+		if (!_args[index])
+			_args[index] = _descriptors[index].make(_descriptors[index], getAlloc());
+		return *_args[index];
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::getArg(StringViewType name) -> ArgType& {
+		std::size_t index = _findName(name);
+		if (index == _npos)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("No such argument in table"), StringType(name)));
+		return _materialize(index);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	template<class T>
+	inline const T& ArgTable<T_Char, T_CharTraits, T_Alloc>::getValue(StringViewType name) {
+		ValueArg<T, T_Char, T_CharTraits, T_Alloc>* arg = dynamic_cast<ValueArg<T, T_Char, T_CharTraits, T_Alloc>*>(&getArg(name));
+		if (!arg)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument in table has a different type"), StringType(name)));
+		return arg->getValue();
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline bool ArgTable<T_Char, T_CharTraits, T_Alloc>::getSwitch(StringViewType name) {
+		SwitchArg<T_Char, T_CharTraits, T_Alloc>* arg = dynamic_cast<SwitchArg<T_Char, T_CharTraits, T_Alloc>*>(&getArg(name));
+		if (!arg)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument in table is not a switch"), StringType(name)));
+		return arg->getValue();
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t ArgTable<T_Char, T_CharTraits, T_Alloc>::countMaterialized() const {
+		std::size_t count = 0;
+		for (const std::unique_ptr<ArgType>& arg : _args) if (arg) count++;
+		return count;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline bool ArgTable<T_Char, T_CharTraits, T_Alloc>::processArg(std::size_t& idx_arg, StringVectorType& args) {
+		if (_ignoreable && ignoreRest())
+			return false;
+
+		constexpr StringViewType strNameStart = nameStartString();
+		constexpr StringViewType strFlagStart = flagStartString();
+		StringViewType token = args[idx_arg];
+
+		if (token.starts_with(strNameStart)) {
+			token.remove_prefix(strNameStart.size());
+			std::size_t index = _findName(token.substr(0, token.find(delimiter())));
+			if (index == _npos)
+				return false;
+			return _materialize(index).processArg(idx_arg, args);
+		}
+
+		if (!token.starts_with(strFlagStart))
+			return false;
+
+		// Any of the characters may be the flag of an entry, as switches
+		// can be combined.  The entry's Arg decides whether it matches.
+		token.remove_prefix(strFlagStart.size());
+		for (std::size_t i = 0; i < token.size() && token[i] != delimiter(); i++) {
+			std::size_t index = _findFlag(token.substr(i, 1));
+			if (index != _npos && _materialize(index).processArg(idx_arg, args))
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::_describeEntries() const -> StringType {
+		StringType s(getAlloc());
+		for (const Descriptor& d : _descriptors) {
+			s += StringConvertType::fromConstBasicChar('\n');
+			if (!d.flag.empty()) {
+				s += flagStartString();
+				s += d.flag;
+				s += StringConvertType::template constBasicString<",  ">();
+			}
+			s += nameStartString();
+			s += d.name;
+			if (!d.typeDesc.empty()) {
+				s += delimiter();
+				s += StringConvertType::fromConstBasicChar('<');
+				s += d.typeDesc;
+				s += StringConvertType::fromConstBasicChar('>');
+			}
+			s += StringConvertType::template constBasicString<"  ">();
+			s += d.desc;
+		}
+		return s;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
+		static_cast<void>(val); // Ignore input, don't warn
+		StringType id = StringConvertType::fromConstBasicCharString("[<");
+		id += _name;
+		id += StringConvertType::fromConstBasicCharString(">...]");
+		return id;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::longID(const StringType& val) const -> StringType {
+		static_cast<void>(val); // Ignore input, don't warn
+		StringType id = StringConvertType::fromConstBasicCharString("<");
+		id += _name;
+		id += StringConvertType::fromConstBasicCharString(">");
+		return id;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTable<T_Char, T_CharTraits, T_Alloc>::reset() {
+		Arg<T_Char, T_CharTraits, T_Alloc>::reset();
+		for (std::unique_ptr<ArgType>& arg : _args) if (arg) arg->reset();
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	template<class T>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::makeValueArg(const Descriptor& d, const AllocatorType& alloc) -> std::unique_ptr<ArgType> {
+		T value = T();
+		if (!d.def.empty())
+			ExtractValue(value, StringType(d.def, alloc), typename ArgTraits<T>::ValueCategory());
+		std::unique_ptr<ValueArg<T, T_Char, T_CharTraits, T_Alloc>> arg = std::make_unique<ValueArg<T, T_Char, T_CharTraits, T_Alloc>>(
+			StringType(d.flag, alloc), StringType(d.name, alloc), DescriptionType::external(d.desc),
+			false, value, StringType(d.typeDesc, alloc), nullptr, alloc);
+		return arg;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto ArgTable<T_Char, T_CharTraits, T_Alloc>::makeSwitchArg(const Descriptor& d, const AllocatorType& alloc) -> std::unique_ptr<ArgType> {
+		std::unique_ptr<SwitchArg<T_Char, T_CharTraits, T_Alloc>> arg = std::make_unique<SwitchArg<T_Char, T_CharTraits, T_Alloc>>(
+			StringType(d.flag, alloc), StringType(d.name, alloc), DescriptionType::external(d.desc),
+			false, nullptr, alloc);
+		return arg;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//END ArgTable.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
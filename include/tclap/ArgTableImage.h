@@ -0,0 +1,322 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ArgTableImage.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_ARG_TABLE_IMAGE_H
+#define TCLAP_ARG_TABLE_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <span>
+#include <ostream>
+
+#include <tclap/StringConvert.h>
+#include <tclap/ArgException.h>
+#include <tclap/ArgTable.h>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class ArgTableImage;
+
+	/**
+	 * A flat, versioned binary image of the descriptors of an ArgTable.
+	 * The image is written once, for example at build time, and can then
+	 * be used straight from read-only memory, such as a file mapped with
+	 * mmap or MapViewOfFile, or an array embedded in the program.  Loading
+	 * an image only checks it and points the descriptors into it; no text
+	 * is copied or converted.  The image also holds the index of the
+	 * entries by name and by flag, so addTo() does not build one.
+	 *
+	 * The types of the entries are stored as indices into a list of
+	 * kinds, which are the MakeArgType functions of the descriptors.  The
+	 * same list must be given when writing and when loading the image.
+	 *
+	 * Layout, in native byte order:
+	 *   header:  magic[8], version, byte order mark, sizeof(T_Char),
+	 *            number of entries, number of entries with a flag,
+	 *            number of characters of text
+	 *   entries: kind, then offset and size of flag, name, desc, def and
+	 *            typeDesc in the text
+	 *   byName:  the positions of all entries, ordered by name
+	 *   byFlag:  the positions of the entries with a flag, ordered by
+	 *            flag
+	 *   text:    the characters of all strings
+	 * All fields of the header and the entries are 32 bit unsigned.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class ArgTableImage : public UseAllocatorBase<T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using typename UseAllocatorBase<T_Alloc>::AllocatorTraitsType;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringConvertType = StringConvert<T_Char, T_CharTraits>;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using ArgTableType = ArgTable<T_Char, T_CharTraits, T_Alloc>;
+		using DescriptorType = typename ArgTableType::Descriptor;
+		using MakeArgType = typename ArgTableType::MakeArgType;
+		using DescriptorVectorType = std::vector<DescriptorType, typename std::allocator_traits<AllocatorType>::template rebind_alloc<DescriptorType>>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+		using UseAllocatorBase<T_Alloc>::rebindAlloc;
+
+		/**
+		 * The version of the layout.  Bumped whenever it changes.
+		 */
+		static constexpr std::uint32_t version = 2;
+
+		ArgTableImage(const ArgTableImage& rhs) = delete;
+		ArgTableImage& operator=(const ArgTableImage& rhs) = delete;
+
+		/**
+		 * Checks an image and makes its descriptors available.  Throws a
+		 * SpecificationException if the image is malformed, was written
+		 * with a different version or character type, or refers to a
+		 * kind that is not in kinds.
+		 * \param image - The image.  Must outlive this object and every
+		 * ArgTable its descriptors are added to, and be aligned to 4 bytes.
+		 * \param kinds - The list of kinds the image was written with.
+		 */
+		ArgTableImage(std::span<const std::byte> image,
+			std::span<const MakeArgType> kinds,
+			const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Returns the descriptors, which refer to the text of the image.
+		 */
+		std::span<const DescriptorType> descriptors() const { return _descriptors; }
+
+		/**
+		 * Returns the positions of all descriptors, ordered by name.
+		 */
+		std::span<const std::uint32_t> byName() const { return _byName; }
+
+		/**
+		 * Returns the positions of the descriptors that have a flag,
+		 * ordered by flag.
+		 */
+		std::span<const std::uint32_t> byFlag() const { return _byFlag; }
+
+		/**
+		 * Adds the descriptors to table together with the index of the
+		 * image.
+		 * \param table - The table to add the entries to.
+		 */
+		void addTo(ArgTableType& table) const { table.add(_descriptors, _byName, _byFlag); }
+
+		/**
+		 * Writes the image of descriptors to os, which should be opened
+		 * in binary mode.  Throws a SpecificationException if a
+		 * descriptor is of a kind that is not in kinds, if two share a
+		 * flag or name, if the image would not fit the 32 bit fields, or
+		 * if os fails while the image is written.
+		 * \param os - The stream to write to.
+		 * \param descriptors - The descriptors to write.
+		 * \param kinds - The list of kinds of the descriptors.
+		 */
+		static void write(std::ostream& os,
+			std::span<const DescriptorType> descriptors,
+			std::span<const MakeArgType> kinds);
+
+	private:
+		static constexpr std::array<char, 8> _magic = { 'T', 'C', 'L', 'A', 'P', 'T', 'B', 'L' };
+		static constexpr std::uint32_t _byteOrderMark = 0x01020304;
+		static constexpr std::size_t _sizeHeader = 8 + 6 * sizeof(std::uint32_t);
+		static constexpr std::size_t _countFieldsEntry = 11;
+
+		static std::uint32_t _read(const std::byte* p) {
+			std::uint32_t n;
+			std::memcpy(&n, p, sizeof(n));
+			return n;
+		}
+
+		static void _write(std::ostream& os, std::uint32_t n) {
+			os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+		}
+
+		template<std::size_t size_what>
+		static SpecificationException<T_Char, T_CharTraits, T_Alloc> _malformed(const char(&what)[size_what]) {
+			return SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+				StringConvertType::fromConstBasicCharString("Malformed ArgTable image"), StringConvertType::fromConstBasicCharString(what));
+		}
+
+		/**
+		 * Orders positions in descriptors by the key of their entry.
+		 * Throws a SpecificationException if two keys are equal.
+		 */
+		static void _sortIndex(std::vector<std::uint32_t>& index,
+			std::span<const DescriptorType> descriptors,
+			StringViewType DescriptorType::* key);
+
+		DescriptorVectorType _descriptors;
+
+		/**
+		 * The index of the image, by name.
+		 */
+		std::span<const std::uint32_t> _byName;
+
+		/**
+		 * The index of the image, by flag.
+		 */
+		std::span<const std::uint32_t> _byFlag;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN ArgTableImage.cpp
+	//////////////////////////////////////////////////////////////////////
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline ArgTableImage<T_Char, T_CharTraits, T_Alloc>::ArgTableImage(std::span<const std::byte> image,
+		std::span<const MakeArgType> kinds,
+		const AllocatorType& alloc)
+		: UseAllocatorBase<T_Alloc>(alloc),
+		_descriptors(alloc),
+		_byName(),
+		_byFlag() {
+		if (reinterpret_cast<std::uintptr_t>(image.data()) % alignof(std::uint32_t) != 0)
+			throw(_malformed("not aligned"));
+		if (image.size() < _sizeHeader || std::memcmp(image.data(), _magic.data(), _magic.size()) != 0)
+			throw(_malformed("bad magic"));
+
+		const std::byte* p = image.data() + _magic.size();
+		if (_read(p) != version)
+			throw(_malformed("unsupported version"));
+		if (_read(p + 4) != _byteOrderMark)
+			throw(_malformed("byte order differs"));
+		if (_read(p + 8) != sizeof(CharType))
+			throw(_malformed("character size differs"));
+		std::size_t countEntries = _read(p + 12);
+		std::size_t countFlags = _read(p + 16);
+		std::size_t countChars = _read(p + 20);
+		if (countFlags > countEntries)
+			throw(_malformed("bad index"));
+
+		std::size_t offsetIndex = _sizeHeader + countEntries * _countFieldsEntry * sizeof(std::uint32_t);
+		std::size_t offsetText = offsetIndex + (countEntries + countFlags) * sizeof(std::uint32_t);
+		offsetText = (offsetText + alignof(CharType) - 1) / alignof(CharType) * alignof(CharType);
+		if (offsetText > image.size() || countChars > (image.size() - offsetText) / sizeof(CharType))
+			throw(_malformed("truncated"));
+		const CharType* text = reinterpret_cast<const CharType*>(image.data() + offsetText);
+
+		_descriptors.reserve(countEntries);
+		p = image.data() + _sizeHeader;
+		for (std::size_t i = 0; i < countEntries; i++, p += _countFieldsEntry * sizeof(std::uint32_t)) {
+			std::size_t kind = _read(p);
+			if (kind >= kinds.size())
+				throw(_malformed("unknown kind"));
+
+			std::array<StringViewType, 5> strs;
+			for (std::size_t j = 0; j < strs.size(); j++) {
+				std::size_t offset = _read(p + (1 + 2 * j) * 4);
+				std::size_t size = _read(p + (2 + 2 * j) * 4);
+				if (offset > countChars || size > countChars - offset)
+					throw(_malformed("string out of range"));
+				strs[j] = StringViewType(text + offset, size);
+			}
+			_descriptors.push_back(DescriptorType{ strs[0], strs[1], strs[2], strs[3], strs[4], kinds[kind] });
+		}
+
+		// The index is checked by ArgTable::add.
+		const std::uint32_t* index = reinterpret_cast<const std::uint32_t*>(image.data() + offsetIndex);
+		_byName = std::span<const std::uint32_t>(index, countEntries);
+		_byFlag = std::span<const std::uint32_t>(index + countEntries, countFlags);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTableImage<T_Char, T_CharTraits, T_Alloc>::_sortIndex(std::vector<std::uint32_t>& index,
+		std::span<const DescriptorType> descriptors,
+		StringViewType DescriptorType::* key) {
+		std::sort(index.begin(), index.end(),
+			[&](std::uint32_t a, std::uint32_t b) { return descriptors[a].*key < descriptors[b].*key; });
+		for (std::size_t i = 1; i < index.size(); i++)
+			if (descriptors[index[i - 1]].*key == descriptors[index[i]].*key)
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+					StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"), StringType(descriptors[index[i]].name)));
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void ArgTableImage<T_Char, T_CharTraits, T_Alloc>::write(std::ostream& os,
+		std::span<const DescriptorType> descriptors,
+		std::span<const MakeArgType> kinds) {
+		constexpr std::size_t maxField = static_cast<std::uint32_t>(-1);
+		std::basic_string<CharType, CharTraitsType> text;
+		std::vector<std::uint32_t> entries;
+		std::vector<std::uint32_t> byName;
+		std::vector<std::uint32_t> byFlag;
+		if (descriptors.size() > maxField)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+				StringConvertType::fromConstBasicCharString("Too many entries for an ArgTable image"), StringType()));
+		entries.reserve(descriptors.size() * _countFieldsEntry);
+		byName.reserve(descriptors.size());
+		for (const DescriptorType& d : descriptors) {
+			const MakeArgType* it = std::find(kinds.data(), kinds.data() + kinds.size(), d.make);
+			if (it == kinds.data() + kinds.size())
+				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+					StringConvertType::fromConstBasicCharString("Argument kind is not in the list of kinds"), StringType(d.name)));
+			entries.push_back(static_cast<std::uint32_t>(it - kinds.data()));
+			for (StringViewType s : { d.flag, d.name, d.desc, d.def, d.typeDesc }) {
+				if (s.size() > maxField - text.size())
+					throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+						StringConvertType::fromConstBasicCharString("Too much text for an ArgTable image"), StringType(d.name)));
+				entries.push_back(static_cast<std::uint32_t>(text.size()));
+				entries.push_back(static_cast<std::uint32_t>(s.size()));
+				text += s;
+			}
+			if (!d.flag.empty())
+				byFlag.push_back(static_cast<std::uint32_t>(byName.size()));
+			byName.push_back(static_cast<std::uint32_t>(byName.size()));
+		}
+		_sortIndex(byName, descriptors, &DescriptorType::name);
+		_sortIndex(byFlag, descriptors, &DescriptorType::flag);
+
+		os.write(_magic.data(), _magic.size());
+		_write(os, version);
+		_write(os, _byteOrderMark);
+		_write(os, static_cast<std::uint32_t>(sizeof(CharType)));
+		_write(os, static_cast<std::uint32_t>(descriptors.size()));
+		_write(os, static_cast<std::uint32_t>(byFlag.size()));
+		_write(os, static_cast<std::uint32_t>(text.size()));
+		for (std::uint32_t n : entries) _write(os, n);
+		for (std::uint32_t n : byName) _write(os, n);
+		for (std::uint32_t n : byFlag) _write(os, n);
+
+		std::size_t offsetText = _sizeHeader + (entries.size() + byName.size() + byFlag.size()) * sizeof(std::uint32_t);
+		for (; offsetText % alignof(CharType) != 0; offsetText++) os.put('\0');
+		os.write(reinterpret_cast<const char*>(text.data()), text.size() * sizeof(CharType));
+		os.flush();
+		if (!os)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+				StringConvertType::fromConstBasicCharString("Couldn't write the ArgTable image"), StringType()));
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//END ArgTableImage.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
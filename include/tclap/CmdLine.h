@@ -25,15 +25,20 @@
 #define TCLAP_CMDLINE_H
 
 #include <tclap/StringConvert.h>
+#include <tclap/DecodedArgv.h>
 
 #include <tclap/SwitchArg.h>
 #include <tclap/MultiSwitchArg.h>
 #include <tclap/UnlabeledValueArg.h>
 #include <tclap/UnlabeledMultiArg.h>
+#include <tclap/SubcommandArg.h>
+#include <tclap/ArgTable.h>
 
 #include <tclap/XorHandler.h>
+#include <tclap/UsageCache.h>
 #include <tclap/Visitor.h>
 #include <tclap/HelpVisitor.h>
+#include <tclap/HelpArg.h>
 #include <tclap/VersionVisitor.h>
 #include <tclap/IgnoreRestVisitor.h>
 
@@ -46,9 +51,11 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <unordered_set>
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <type_traits>
 #include <stdlib.h> // Needed for exit(), which isn't defined in some envs.
 
 namespace TCLAP {
@@ -75,7 +82,11 @@ namespace TCLAP {
 		using typename CmdLineInterface<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
 		using typename CmdLineInterface<T_Char, T_CharTraits, T_Alloc>::CmdLineOutputType;
 		using typename CmdLineInterface<T_Char, T_CharTraits, T_Alloc>::XorHandlerType;
+		using typename CmdLineInterface<T_Char, T_CharTraits, T_Alloc>::UsageCacheType;
 		using VisitorListType = std::list<Visitor*, typename std::allocator_traits<AllocatorType>::template rebind_alloc<Visitor*>>;
+		using StringPoolType = typename ArgType::StringPoolType;
+		using ParseEventType = ParseEvent<T_Char, T_CharTraits, T_Alloc>;
+		using ParseEventSinkType = ParseEventSink<T_Char, T_CharTraits, T_Alloc>;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -87,6 +98,21 @@ namespace TCLAP {
 		 */
 		ArgListType _argList;
 
+		using ArgIndexType = std::unordered_set<StringViewType, StringHash<T_Char, T_CharTraits>, std::equal_to<StringViewType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<StringViewType>>;
+
+		/**
+		 * The flags of the Args in _argList, so that add() finds
+		 * duplicates without comparing against every Arg.  Refers to
+		 * the strings of the Args.
+		 */
+		ArgIndexType _flagIndex;
+
+		/**
+		 * The names of the Args in _argList.  Refers to the strings of
+		 * the Args.
+		 */
+		ArgIndexType _nameIndex;
+
 		/**
 		 * The name of the program.  Set to argv[0].
 		 */
@@ -158,6 +184,21 @@ namespace TCLAP {
 		 * \param s - The message to be used in the usage.
 		 */
 		bool _emptyCombined(const StringType& s);
+
+		/**
+		 * Offers args[idx_arg] to the Args in _argList in order and
+		 * returns the one that consumed it, or nullptr if none did.
+		 * \param idx_arg - The index of the current argument.
+		 * \param args - The list of arguments.
+		 */
+		virtual ArgType* _matchArg(std::size_t& idx_arg, StringVectorType& args);
+
+		/**
+		 * Runs the xor and required checks for an Arg just returned by
+		 * _matchArg and returns the number of required Args it set.
+		 * \param arg - The matched Arg.
+		 */
+		virtual std::size_t _checkArg(ArgType* arg);
 	private:
 
 		/**
@@ -182,6 +223,33 @@ namespace TCLAP {
 		 */
 		bool _ignoreUnmatched;
 
+		/**
+		 * Whether or not the text of added Args is interned into
+		 * _stringPool.
+		 */
+		bool _poolStrings;
+
+		/**
+		 * Holds the descriptions of the added Args when string pooling
+		 * is enabled.
+		 */
+		StringPoolType _stringPool;
+
+		/**
+		 * The usage rendered by the outputs, cleared when Args are added.
+		 */
+		UsageCacheType _usageCache;
+
+		/**
+		 * Statistics that parse() adds to, or null.
+		 */
+		ParseStats* _parseStats;
+
+		/**
+		 * Receives the events of parse(), or null.
+		 */
+		ParseEventSinkType* _eventSink;
+
 	public:
 
 		/**
@@ -241,6 +309,32 @@ namespace TCLAP {
 		 */
 		virtual void parse(int argc, const CharType* const* argv) override;
 
+		/**
+		 * Parses the native narrow argv of main, for a CmdLine of another
+		 * character type.  The arguments are decoded from the multibyte
+		 * encoding of the current locale into one arena (see DecodedArgv)
+		 * rather than one string at a time.  A template, so that it doesn't
+		 * override parse(int, const CharType* const*) when CharType is char.
+		 * \param argc - Number of arguments.
+		 * \param argv - Array of arguments.
+		 */
+		template<typename T_MBChar>
+			requires (std::is_same_v<T_MBChar, char> && !std::is_same_v<T_Char, char>)
+		void parse(int argc, const T_MBChar* const* argv) {
+			TCLAP_PARSE_STATS_SCOPE(_parseStats);
+
+			// The Args edit the tokens, so each one is still copied out of
+			// the arena once.
+			StringVectorType args;
+			{
+				TCLAP_PARSE_STATS_TIME(tokenizationNs);
+				DecodedArgv<T_Char, T_CharTraits, T_Alloc> decoded(argc, argv, getAlloc());
+				args.reserve(decoded.size());
+				for (std::size_t i = 0; i < decoded.size(); i++) args.emplace_back(decoded[i]);
+			}
+			parse(args);
+		}
+
 		/**
 		 * Parses the command line.
 		 * \param args - A vector of strings representing the args.
@@ -293,6 +387,13 @@ namespace TCLAP {
 		 */
 		virtual bool hasHelpAndVersion() override;
 
+		/**
+		 * Returns the cache of the usage rendered by the outputs.  It is
+		 * cleared when Args are added, but has to be cleared by the caller
+		 * after changing an Arg or the message that were already added.
+		 */
+		virtual UsageCacheType* getUsageCache() override;
+
 		/**
 		 * Disables or enables CmdLine's internal parsing exception handling.
 		 *
@@ -320,6 +421,46 @@ namespace TCLAP {
 		 * and if false it will behave as normal.
 		 */
 		void ignoreUnmatched(const bool ignore);
+
+		/**
+		 * Enables or disables interning of the descriptions of Args
+		 * into a pool owned by this CmdLine, so that their text is
+		 * stored contiguously and only once.  By
+		 * default false.  Enabling it also interns the Args that have
+		 * already been added.  Once interned, an Arg refers to storage
+		 * owned by the CmdLine, so it must not be used after the CmdLine
+		 * has been destroyed.
+		 *
+		 * @param pool If true the text of added Args is pooled.
+		 */
+		void setStringPooling(const bool pool);
+
+		/**
+		 * Attaches statistics that parse() adds its counts and timings
+		 * to, or detaches them when null.  Only gathered when
+		 * TCLAP_PARSE_STATS is defined, see ParseStats.h.
+		 *
+		 * @param stats The statistics, which must outlive the parses.
+		 */
+		void setParseStats(ParseStats* stats);
+
+		/**
+		 * Returns the attached statistics, or null.
+		 */
+		ParseStats* getParseStats() const;
+
+		/**
+		 * Sets the sink that receives the events of parse(), or removes
+		 * it when null.
+		 *
+		 * @param sink The sink, which must outlive the parses.
+		 */
+		void setEventSink(ParseEventSinkType* sink);
+
+		/**
+		 * Returns the sink, or null.
+		 */
+		ParseEventSinkType* getEventSink() const;
 	};
 
 
@@ -336,6 +477,8 @@ namespace TCLAP {
 		:
 		CmdLineInterface<T_Char, T_CharTraits, T_Alloc>(alloc),
 		_argList(ArgListType()),
+		_flagIndex(alloc),
+		_nameIndex(alloc),
 		_progName(StringConvertType::fromConstBasicCharString("not_set_yet")),
 		_message(m),
 		_version(v),
@@ -346,7 +489,12 @@ namespace TCLAP {
 		_visitorPrivateVec(alloc),
 		_handleExceptions(true),
 		_helpAndVersion(help),
-		_ignoreUnmatched(false) {
+		_ignoreUnmatched(false),
+		_poolStrings(false),
+		_stringPool(StringPoolType::sizeChunkDefault, alloc),
+		_usageCache(alloc),
+		_parseStats(nullptr),
+		_eventSink(nullptr) {
 		_constructor();
 	}
 
@@ -363,11 +511,22 @@ namespace TCLAP {
 		if (_helpAndVersion) 	{
 			{
 				std::unique_ptr<HelpVisitor<T_Char, T_CharTraits, T_Alloc>> v = std::make_unique<HelpVisitor<T_Char, T_CharTraits, T_Alloc>>(this, &_output, getAlloc());
-				std::unique_ptr<SwitchArg<T_Char, T_CharTraits, T_Alloc>> help = std::make_unique<SwitchArg<T_Char, T_CharTraits, T_Alloc>>(
+				// Only mention sections when there are any, which is known
+				// once the help is printed.
+				auto helpDesc = [visitor = &*v, alloc = getAlloc()]() {
+					if (!visitor->hasSections())
+						return StringType(StringConvertType::template constBasicString<"Displays usage information and exits.">(), alloc);
+					StringType desc(StringConvertType::template constBasicString<"Displays usage information, or with ">(), alloc);
+					desc.append(ArgType::nameStartString()).append(StringConvertType::template constBasicString<"help">());
+					desc.push_back(HelpArg<T_Char, T_CharTraits, T_Alloc>::sectionDelimiter());
+					desc.append(StringConvertType::template constBasicString<"<section> only that section of it, and exits.">());
+					return desc;
+				};
+				std::unique_ptr<HelpArg<T_Char, T_CharTraits, T_Alloc>> help = std::make_unique<HelpArg<T_Char, T_CharTraits, T_Alloc>>(
 					StringConvertType::fromConstBasicCharString("h"),
 					StringConvertType::fromConstBasicCharString("help"),
-					StringConvertType::fromConstBasicCharString("Displays usage information and exits."),
-					false, &*v, getAlloc());
+					helpDesc,
+					&*v, getAlloc());
 				add(*help);
 				_visitorPrivateVec.push_back(std::move(v));
 				_argPrivateVec.push_back(std::move(help));
@@ -386,8 +545,8 @@ namespace TCLAP {
 		}
 		{
 			std::unique_ptr<IgnoreRestVisitor<T_Char, T_CharTraits, T_Alloc>> v = std::make_unique<IgnoreRestVisitor<T_Char, T_CharTraits, T_Alloc>>(getAlloc());
-			std::unique_ptr<SwitchArg<T_Char, T_CharTraits, T_Alloc>> ignore = std::make_unique<SwitchArg<T_Char, T_CharTraits, T_Alloc>>(ArgType::flagStartString(),
-				ArgType::ignoreNameString(),
+			std::unique_ptr<SwitchArg<T_Char, T_CharTraits, T_Alloc>> ignore = std::make_unique<SwitchArg<T_Char, T_CharTraits, T_Alloc>>(StringType(ArgType::flagStartString(), getAlloc()),
+				StringType(ArgType::ignoreNameString(), getAlloc()),
 				StringConvertType::fromConstBasicCharString("Ignores the rest of the labeled arguments following this flag."),
 				false, &*v, getAlloc());
 			add(*ignore);
@@ -399,10 +558,11 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::xorAdd(const ArgVectorType& ors) {
 		_xorHandler.add(ors);
+		_usageCache.clear();
 
 		for (ArgType* const& arg : ors) 	{
 			arg->forceRequired();
-			arg->setRequireLabel(StringConvertType::fromConstBasicCharString("OR required"));
+			arg->setStaticRequireLabel(ArgType::xorRequiredLabel());
 			add(arg);
 		}
 	}
@@ -422,14 +582,20 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::add(ArgType* a) {
-		for (const ArgType* const& arg : _argList)
-			if (*a == *arg)
-				throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
-					StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"),
-					a->longID()
-				));
+		if ((!a->getFlag().empty() && _flagIndex.contains(a->getFlag())) || _nameIndex.contains(a->getName()))
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+				StringConvertType::fromConstBasicCharString("Argument with same flag/name already exists!"),
+				a->longID()
+			));
+
+		if (_poolStrings)
+			a->internStrings(_stringPool);
 
 		a->addToList(_argList);
+		if (!a->getFlag().empty())
+			_flagIndex.insert(a->getFlag());
+		_nameIndex.insert(a->getName());
+		_usageCache.clear();
 
 		if (a->isRequired())
 			_numRequired++;
@@ -438,32 +604,51 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::parse(int argc, const CharType* const* argv) {
+		TCLAP_PARSE_STATS_SCOPE(_parseStats);
+
 		// this step is necessary so that we have easy access to
 		// mutable strings.
 		StringVectorType args;
-		for (int i = 0; i < argc; i++) args.push_back(argv[i]);
+		{
+			TCLAP_PARSE_STATS_TIME(tokenizationNs);
+			args.reserve(argc > 0 ? static_cast<std::size_t>(argc) : 0);
+			for (int i = 0; i < argc; i++) args.push_back(argv[i]);
+		}
 		parse(args);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::parse(StringVectorType& args) {
+		TCLAP_PARSE_STATS_SCOPE(_parseStats);
 		bool shouldExit = false;
 		int estat = 0;
 
 		try {
-			_progName = args.front();
-			args.erase(args.begin());
+			{
+				TCLAP_PARSE_STATS_TIME(tokenizationNs);
+				_progName = args.front();
+				args.erase(args.begin());
+			}
+			TCLAP_PARSE_STATS_COUNT(tokens, args.size());
+
+			ParseEventScope<T_Char, T_CharTraits, T_Alloc> eventScope(_eventSink, args);
+			typename ParseEventSinkType::Context& events = ParseEventSinkType::context();
 
 			std::size_t requiredCount = 0;
 
 			for (std::size_t idx_arg = 0; idx_arg < args.size(); idx_arg++) 		{
+				TCLAP_PARSE_STATS_TIME(matchingNs);
 				bool matched = false;
-				for (ArgType* const& arg : _argList) {
-					if (arg->processArg(idx_arg, args)) 				{
-						requiredCount += _xorHandler.check(arg);
-						matched = true;
-						break;
-					}
+				events.first = idx_arg;
+				events.matched = false;
+				if (ArgType* arg = _matchArg(idx_arg, args)) {
+					// combined switches report themselves
+					if (_eventSink && !events.matched)
+						_eventSink->event(ParseEventType{ParseEventKind::ArgMatched, arg, events.first + 1, idx_arg - events.first + 1, args[events.first]});
+
+					TCLAP_PARSE_STATS_TIME(validationNs);
+					requiredCount += _checkArg(arg);
+					matched = true;
 				}
 
 				// checks to see if the argument is an empty combined
@@ -473,8 +658,12 @@ namespace TCLAP {
 
 				if (!matched && !ArgType::ignoreRest() && !_ignoreUnmatched)
 					throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Couldn't find match for argument"), args[idx_arg]));
+
+				if (!matched && _eventSink)
+					_eventSink->event(ParseEventType{ParseEventKind::Unmatched, nullptr, idx_arg + 1, 1, args[idx_arg]});
 			}
 
+			TCLAP_PARSE_STATS_TIME(validationNs);
 			if (requiredCount < _numRequired)
 				missingArgsException();
 
@@ -482,6 +671,8 @@ namespace TCLAP {
 				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Too many arguments!")));
 
 		} catch (ArgException<T_Char, T_CharTraits, T_Alloc>& e) {
+			TCLAP_PARSE_STATS_COUNT(exceptions, 1);
+
 			// If we're not handling the exceptions, rethrow.
 			if (!_handleExceptions) {
 				throw;
@@ -494,6 +685,8 @@ namespace TCLAP {
 				shouldExit = true;
 			}
 		} catch (ExitException& ee) {
+			TCLAP_PARSE_STATS_COUNT(exceptions, 1);
+
 			// If we're not handling the exceptions, rethrow.
 			if (!_handleExceptions) {
 				throw;
@@ -507,10 +700,25 @@ namespace TCLAP {
 			exit(estat);
 	}
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto CmdLine<T_Char, T_CharTraits, T_Alloc>::_matchArg(std::size_t& idx_arg, StringVectorType& args) -> ArgType* {
+		for (ArgType* const& arg : _argList) {
+			TCLAP_PARSE_STATS_COUNT(processArgCalls, 1);
+			if (arg->processArg(idx_arg, args))
+				return arg;
+		}
+		return nullptr;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t CmdLine<T_Char, T_CharTraits, T_Alloc>::_checkArg(ArgType* arg) {
+		return _xorHandler.check(arg);
+	}
+
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline bool CmdLine<T_Char, T_CharTraits, T_Alloc>::_emptyCombined(const StringType& s) {
 		if (!s.empty() && s.front() != ArgType::flagStartChar()) return false;
-		for (const CharType& ch : s) if (ch != ArgType::blankChar()) return false;
+		for (std::size_t i = 1; i < s.size(); i++) if (s[i] != ArgType::blankChar()) return false;
 		return true;
 	}
 
@@ -583,6 +791,11 @@ namespace TCLAP {
 		return _helpAndVersion;
 	}
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto CmdLine<T_Char, T_CharTraits, T_Alloc>::getUsageCache() -> UsageCacheType* {
+		return &_usageCache;
+	}
+
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::setExceptionHandling(const bool state) {
 		_handleExceptions = state;
@@ -604,6 +817,33 @@ namespace TCLAP {
 		_ignoreUnmatched = ignore;
 	}
 
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::setStringPooling(const bool pool) {
+		if (pool && !_poolStrings)
+			for (ArgType* const& arg : _argList) arg->internStrings(_stringPool);
+		_poolStrings = pool;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::setParseStats(ParseStats* stats) {
+		_parseStats = stats;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline ParseStats* CmdLine<T_Char, T_CharTraits, T_Alloc>::getParseStats() const {
+		return _parseStats;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void CmdLine<T_Char, T_CharTraits, T_Alloc>::setEventSink(ParseEventSinkType* sink) {
+		_eventSink = sink;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto CmdLine<T_Char, T_CharTraits, T_Alloc>::getEventSink() const -> ParseEventSinkType* {
+		return _eventSink;
+	}
+
 	///////////////////////////////////////////////////////////////////////////////
 	//End CmdLine.cpp
 	///////////////////////////////////////////////////////////////////////////////
@@ -611,4 +851,9 @@ namespace TCLAP {
 
 
 } //namespace TCLAP
+
+#ifdef TCLAP_EXTERN_TEMPLATES
+#include <tclap/ExternTemplates.h>
+#endif
+
 #endif
@@ -46,6 +46,8 @@ namespace TCLAP {
 	class CmdLineOutput;
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	class XorHandler;
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class UsageCache;
 
 	/**
 	 * The base class that manages the command line definition and passes
@@ -70,6 +72,7 @@ namespace TCLAP {
 		using CmdLineInterfaceType = CmdLineInterface<T_Char, T_CharTraits, T_Alloc>;
 		using CmdLineOutputType = CmdLineOutput<T_Char, T_CharTraits, T_Alloc>;
 		using XorHandlerType = XorHandler<T_Char, T_CharTraits, T_Alloc>;
+		using UsageCacheType = UsageCache<T_Char, T_CharTraits, T_Alloc>;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -168,6 +171,12 @@ namespace TCLAP {
 		 */
 		virtual bool hasHelpAndVersion() = 0;
 
+		/**
+		 * Returns the cache of the usage rendered by the outputs, or null
+		 * if the usage isn't cached.
+		 */
+		virtual UsageCacheType* getUsageCache() { return nullptr; }
+
 		/**
 		 * Resets the instance as if it had just been constructed so that the
 		 * instance can be reused.
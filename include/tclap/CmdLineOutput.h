@@ -35,6 +35,7 @@
 
 #include <tclap/StringConvert.h>
 #include <tclap/UseAllocatorBase.h>
+#include <tclap/OutputBuffer.h>
 
 namespace TCLAP {
 
@@ -47,6 +48,8 @@ class CmdLineOutput;
 template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 class XorHandler;
 template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+class UsageCache;
+template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 class ArgException;
 
 /**
@@ -74,6 +77,8 @@ class CmdLineOutput : public UseAllocatorBase<T_Alloc>
 		using CmdLineInterfaceType = CmdLineInterface<T_Char, T_CharTraits, T_Alloc>;
 		using CmdLineOutputType = CmdLineOutput<T_Char, T_CharTraits, T_Alloc>;
 		using XorHandlerType = XorHandler<T_Char, T_CharTraits, T_Alloc>;
+		using OutputBufferType = OutputBuffer<T_Char, T_CharTraits, T_Alloc>;
+		using UsageCacheType = UsageCache<T_Char, T_CharTraits, T_Alloc>;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -103,6 +108,16 @@ class CmdLineOutput : public UseAllocatorBase<T_Alloc>
 		 */
 		virtual void failure( CmdLineInterfaceType& c, ArgException<T_Char, T_CharTraits, T_Alloc>& e )=0;
 
+		/**
+		 * Generates the usage of the Args in one section of the help,
+		 * see Arg::setSection.  Outputs without sections generate the
+		 * whole usage.
+		 * \param c - The CmdLine object the output is generated for. 
+		 * \param section - The name of the section.
+		 * \return Whether any Arg is in the section.
+		 */
+		virtual bool sectionUsage(CmdLineInterfaceType& c, StringViewType section) { (void)section; usage(c); return true; }
+
 };
 
 } //namespace TCLAP
@@ -0,0 +1,143 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  DecodedArgv.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_DECODEDARGV_H
+#define TCLAP_DECODEDARGV_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tclap/UseAllocatorBase.h>
+#include <tclap/StringConvert.h>
+
+namespace TCLAP {
+	/**
+	 * The native narrow argv of main, decoded from the multibyte encoding
+	 * into T_Char.  All entries are decoded into one contiguous arena, each
+	 * followed by a null character, and are found by their offsets, so
+	 * that decoding the whole command line allocates a fixed number of
+	 * times whatever argc is.  The UTF-8 fast path of StringConvert is used
+	 * when the locale allows it.
+	 *
+	 * argv() returns an array like the one main gets, pointing into the
+	 * arena, which can be passed to the parse() of CmdLine or
+	 * StaticCmdLine.  The entries stay valid as long as the DecodedArgv.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class DecodedArgv : public UseAllocatorBase<T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using StringConvertType = StringConvert<T_Char, T_CharTraits>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+
+		// The pointers of argv() point into the arena, which a copy or a
+		// move of a short one would leave behind.
+		DecodedArgv(const DecodedArgv& rhs) = delete;
+		DecodedArgv& operator=(const DecodedArgv& rhs) = delete;
+
+		/**
+		 * Decodes argv.
+		 * \param argc - Number of arguments.
+		 * \param argv - Array of arguments in the multibyte encoding of
+		 * the current locale.
+		 */
+		DecodedArgv(int argc, const char* const* argv, const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Returns the number of arguments.
+		 */
+		int argc() const { return static_cast<int>(size()); }
+
+		/**
+		 * Returns the decoded arguments, followed by a null pointer like
+		 * the argv of main.
+		 */
+		const CharType* const* argv() const { return _pointers.data(); }
+
+		/**
+		 * Returns the number of arguments.
+		 */
+		std::size_t size() const { return _offsets.size() - 1; }
+
+		/**
+		 * Returns a view of a decoded argument, without its terminating
+		 * null character.
+		 */
+		StringViewType operator[](std::size_t idx) const {
+			return StringViewType(_arena.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx] - 1);
+		}
+
+	private:
+		using OffsetVectorType = std::vector<std::size_t, typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::size_t>>;
+		using PointerVectorType = std::vector<const CharType*, typename std::allocator_traits<AllocatorType>::template rebind_alloc<const CharType*>>;
+
+		StringType _arena;
+
+		/**
+		 * The start of each argument in the arena, and the end of the
+		 * arena last.
+		 */
+		OffsetVectorType _offsets;
+
+		PointerVectorType _pointers;
+	};
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline DecodedArgv<T_Char, T_CharTraits, T_Alloc>::DecodedArgv(int argc, const char* const* argv, const AllocatorType& alloc)
+		: UseAllocatorBase<T_Alloc>(alloc),
+		_arena(alloc),
+		_offsets(alloc),
+		_pointers(alloc) {
+		std::size_t count = argc > 0 ? static_cast<std::size_t>(argc) : 0;
+
+		// Every entry is decoded into what is left of one reservation,
+		// which the bound for all the bytes with their terminators leaves
+		// enough of.
+		std::size_t size_mbs = 0;
+		for (std::size_t i = 0; i < count; i++)
+			size_mbs += std::char_traits<char>::length(argv[i]) + 1;
+		_arena.reserve(StringConvertType::maxFromMBSize(size_mbs));
+		_offsets.reserve(count + 1);
+		for (std::size_t i = 0; i < count; i++) {
+			_offsets.push_back(_arena.size());
+			StringConvertType::fromMBString(std::basic_string_view<char, std::char_traits<char>>(argv[i]), _arena);
+			_arena.push_back(CharType());
+		}
+		_offsets.push_back(_arena.size());
+
+		_pointers.reserve(count + 1);
+		for (std::size_t i = 0; i < count; i++)
+			_pointers.push_back(_arena.data() + _offsets[i]);
+		_pointers.push_back(nullptr);
+	}
+
+} //namespace TCLAP
+
+#endif
@@ -32,6 +32,7 @@
 #include <iostream>
 
 #include <tclap/StringConvert.h>
+#include <tclap/OutputBuffer.h>
 #include <tclap/CmdLineInterface.h>
 #include <tclap/CmdLineOutput.h>
 #include <tclap/XorHandler.h>
@@ -64,6 +65,7 @@ namespace TCLAP {
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineOutputType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::XorHandlerType;
+		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::OutputBufferType;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -91,7 +93,8 @@ namespace TCLAP {
 
 		DocBookOutput(const AllocatorType& alloc = AllocatorType())
 			: CmdLineOutput<T_Char, T_CharTraits, T_Alloc>(alloc),
-			theDelimiter(StringConvertType::fromConstBasicChar('=')) {
+			theDelimiter(StringConvertType::fromConstBasicChar('=')),
+			_buffer(alloc) {
 		}
 	protected:
 
@@ -110,81 +113,87 @@ namespace TCLAP {
 
 		CharType theDelimiter;
 		ConvertedStdioStreams<T_Char, T_CharTraits> convertedStdioStreams;
+
+		/**
+		 * The document being rendered, written to stdout at once.
+		 */
+		OutputBufferType _buffer;
 	};
 
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void DocBookOutput<T_Char, T_CharTraits, T_Alloc>::version(CmdLineInterfaceType& _cmd) {
-		OstreamType& os = convertedStdioStreams.getCout();
-		os << _cmd.getVersion() << std::endl;
+		_buffer << _cmd.getVersion() << std::endl;
+		_buffer.writeTo(convertedStdioStreams.getCout());
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void DocBookOutput<T_Char, T_CharTraits, T_Alloc>::usage(CmdLineInterfaceType& _cmd) {
-		OstreamType& os = convertedStdioStreams.getCout();
-		ArgListType argList = _cmd.getArgList();
+		OutputBufferType& os = _buffer;
+		const ArgListType& argList = _cmd.getArgList();
 		StringType progName = _cmd.getProgramName();
-		StringType xversion = _cmd.getVersion();
+		const StringType& xversion = _cmd.getVersion();
 		theDelimiter = _cmd.getDelimiter();
-		XorHandlerType xorHandler = _cmd.getXorHandler();
-		const ArgVectorVectorType xorList = xorHandler.getXorList();
+		const XorHandlerType& xorHandler = _cmd.getXorHandler();
+		const ArgVectorVectorType& xorList = xorHandler.getXorList();
 		basename(progName);
 
-		os << StringConvertType::fromConstBasicCharString("<?xml version=\"1.0\"?>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<!DOCTYPE refentry PUBLIC \"-//OASIS//DTD DocBook XML V4.2//EN\"") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("\t\"http://www.oasis-open.org/docbook/xml/4.2/docbookx.dtd\">") << std::endl << std::endl;
+		os << StringConvertType::template constBasicString<"<?xml version=\"1.0\"?>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<!DOCTYPE refentry PUBLIC \"-//OASIS//DTD DocBook XML V4.2//EN\"">() << std::endl;
+		os << StringConvertType::template constBasicString<"\t\"http://www.oasis-open.org/docbook/xml/4.2/docbookx.dtd\">">() << std::endl << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refentry>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refentry>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refmeta>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<refentrytitle>") << progName << StringConvertType::fromConstBasicCharString("</refentrytitle>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<manvolnum>1</manvolnum>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refmeta>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refmeta>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<refentrytitle>">() << progName << StringConvertType::template constBasicString<"</refentrytitle>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<manvolnum>1</manvolnum>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refmeta>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refnamediv>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<refname>") << progName << StringConvertType::fromConstBasicCharString("</refname>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<refpurpose>") << _cmd.getMessage() << StringConvertType::fromConstBasicCharString("</refpurpose>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refnamediv>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refnamediv>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<refname>">() << progName << StringConvertType::template constBasicString<"</refname>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<refpurpose>">() << _cmd.getMessage() << StringConvertType::template constBasicString<"</refpurpose>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refnamediv>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refsynopsisdiv>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<cmdsynopsis>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refsynopsisdiv>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<cmdsynopsis>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<command>") << progName << StringConvertType::fromConstBasicCharString("</command>") << std::endl;
+		os << StringConvertType::template constBasicString<"<command>">() << progName << StringConvertType::template constBasicString<"</command>">() << std::endl;
 
 		// xor
 		for (const ArgVectorType& xorEntry : xorList) {
-			os << StringConvertType::fromConstBasicCharString("<group choice=\"req\">") << std::endl;
+			os << StringConvertType::template constBasicString<"<group choice=\"req\">">() << std::endl;
 			for (const ArgType* const& arg : xorEntry) printShortArg(arg);
-			os << StringConvertType::fromConstBasicCharString("</group>") << std::endl;
+			os << StringConvertType::template constBasicString<"</group>">() << std::endl;
 		}
 		// rest of args
 		for (const ArgType* const& arg : argList) if (!xorHandler.contains(arg)) printShortArg(arg);
 
-		os << StringConvertType::fromConstBasicCharString("</cmdsynopsis>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refsynopsisdiv>") << std::endl;
+		os << StringConvertType::template constBasicString<"</cmdsynopsis>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refsynopsisdiv>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refsect1>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<title>Description</title>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<para>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refsect1>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<title>Description</title>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<para>">() << std::endl;
 		os << _cmd.getMessage() << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</para>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refsect1>") << std::endl;
+		os << StringConvertType::template constBasicString<"</para>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refsect1>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refsect1>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<title>Options</title>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<variablelist>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refsect1>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<title>Options</title>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<variablelist>">() << std::endl;
 		for (const ArgType* const& arg : argList) printLongArg(arg);
-		os << StringConvertType::fromConstBasicCharString("</variablelist>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refsect1>") << std::endl;
+		os << StringConvertType::template constBasicString<"</variablelist>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refsect1>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<refsect1>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<title>Version</title>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<para>") << std::endl;
+		os << StringConvertType::template constBasicString<"<refsect1>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<title>Version</title>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<para>">() << std::endl;
 		os << xversion << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</para>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</refsect1>") << std::endl;
+		os << StringConvertType::template constBasicString<"</para>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</refsect1>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("</refentry>") << std::endl;
+		os << StringConvertType::template constBasicString<"</refentry>">() << std::endl;
+		_buffer.writeTo(convertedStdioStreams.getCout());
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
@@ -223,7 +232,7 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void DocBookOutput<T_Char, T_CharTraits, T_Alloc>::printShortArg(const ArgType* a) {
-		OstreamType& os = convertedStdioStreams.getCout();
+		OutputBufferType& os = _buffer;
 		StringType lt = StringConvertType::fromConstBasicCharString("&lt;");
 		StringType gt = StringConvertType::fromConstBasicCharString("&gt;");
 
@@ -236,8 +245,8 @@ namespace TCLAP {
 		StringType choice = StringConvertType::fromConstBasicCharString("opt");
 		if (a->isRequired()) choice = StringConvertType::fromConstBasicCharString("plain");
 
-		os << StringConvertType::fromConstBasicCharString("<arg choice=\"") << choice << StringConvertType::fromConstBasicChar('\"');
-		if (a->acceptsMultipleValues()) os << StringConvertType::fromConstBasicCharString(" rep=\"repeat\"");
+		os << StringConvertType::template constBasicString<"<arg choice=\"">() << choice << StringConvertType::fromConstBasicChar('\"');
+		if (a->acceptsMultipleValues()) os << StringConvertType::template constBasicString<" rep=\"repeat\"">();
 
 		os << StringConvertType::fromConstBasicChar('>');
 		if (!a->getFlag().empty())
@@ -253,15 +262,15 @@ namespace TCLAP {
 			removeChar(arg, StringConvertType::fromConstBasicChar('.'));
 			arg.erase(0, arg.find_last_of(theDelimiter) + 1);
 			os << theDelimiter;
-			os << StringConvertType::fromConstBasicCharString("<replaceable>") << arg << StringConvertType::fromConstBasicCharString("</replaceable>");
+			os << StringConvertType::template constBasicString<"<replaceable>">() << arg << StringConvertType::template constBasicString<"</replaceable>">();
 		}
-		os << StringConvertType::fromConstBasicCharString("</arg>") << std::endl;
+		os << StringConvertType::template constBasicString<"</arg>">() << std::endl;
 
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void DocBookOutput<T_Char, T_CharTraits, T_Alloc>::printLongArg(const ArgType* a) {
-		OstreamType& os = convertedStdioStreams.getCout();
+		OutputBufferType& os = _buffer;
 		StringType lt = StringConvertType::fromConstBasicCharString("&lt;");
 		StringType gt = StringConvertType::fromConstBasicCharString("&gt;");
 
@@ -269,18 +278,18 @@ namespace TCLAP {
 		substituteSpecialChars(desc, StringConvertType::fromConstBasicChar('<'), lt);
 		substituteSpecialChars(desc, StringConvertType::fromConstBasicChar('>'), gt);
 
-		os << StringConvertType::fromConstBasicCharString("<varlistentry>") << std::endl;
+		os << StringConvertType::template constBasicString<"<varlistentry>">() << std::endl;
 
 		if (!a->getFlag().empty()) {
-			os << StringConvertType::fromConstBasicCharString("<term>") << std::endl;
-			os << StringConvertType::fromConstBasicCharString("<option>") << std::endl;
+			os << StringConvertType::template constBasicString<"<term>">() << std::endl;
+			os << StringConvertType::template constBasicString<"<option>">() << std::endl;
 			os << a->flagStartChar() << a->getFlag();
-			os << StringConvertType::fromConstBasicCharString("</option>") << std::endl;
-			os << StringConvertType::fromConstBasicCharString("</term>") << std::endl;
+			os << StringConvertType::template constBasicString<"</option>">() << std::endl;
+			os << StringConvertType::template constBasicString<"</term>">() << std::endl;
 		}
 
-		os << StringConvertType::fromConstBasicCharString("<term>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<option>");
+		os << StringConvertType::template constBasicString<"<term>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<option>">();
 		os << a->nameStartString() << a->getName();
 		if (a->isValueRequired()) {
 			StringType arg = a->shortID();
@@ -291,18 +300,18 @@ namespace TCLAP {
 			removeChar(arg, StringConvertType::fromConstBasicChar('.'));
 			arg.erase(0, arg.find_last_of(theDelimiter) + 1);
 			os << theDelimiter;
-			os << StringConvertType::fromConstBasicCharString("<replaceable>") << arg << StringConvertType::fromConstBasicCharString("</replaceable>");
+			os << StringConvertType::template constBasicString<"<replaceable>">() << arg << StringConvertType::template constBasicString<"</replaceable>">();
 		}
-		os << StringConvertType::fromConstBasicCharString("</option>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</term>") << std::endl;
+		os << StringConvertType::template constBasicString<"</option>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</term>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("<listitem>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("<para>") << std::endl;
+		os << StringConvertType::template constBasicString<"<listitem>">() << std::endl;
+		os << StringConvertType::template constBasicString<"<para>">() << std::endl;
 		os << desc << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</para>") << std::endl;
-		os << StringConvertType::fromConstBasicCharString("</listitem>") << std::endl;
+		os << StringConvertType::template constBasicString<"</para>">() << std::endl;
+		os << StringConvertType::template constBasicString<"</listitem>">() << std::endl;
 
-		os << StringConvertType::fromConstBasicCharString("</varlistentry>") << std::endl;
+		os << StringConvertType::template constBasicString<"</varlistentry>">() << std::endl;
 	}
 
 } //namespace TCLAP
@@ -0,0 +1,100 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ExternTemplates.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_EXTERN_TEMPLATES_H
+#define TCLAP_EXTERN_TEMPLATES_H
+
+/*
+ * Declares the common instantiations of the library as extern templates,
+ * for char and wchar_t with std::allocator, so that a translation unit
+ * including CmdLine.h doesn't instantiate them again.  Included by
+ * CmdLine.h when TCLAP_EXTERN_TEMPLATES is defined, in which case the
+ * program must link the instantiations compiled from
+ * src/ExternTemplates.cpp, which is the TCLAP_compiled target of the
+ * CMake build.  That file defines TCLAP_EXTERN_TEMPLATE to template to
+ * turn the declarations into definitions.
+ *
+ * TCLAP_SETBASE_ZERO, TCLAP_PARSE_STATS and the start strings change
+ * the inline definitions, so every translation unit of a program must
+ * be compiled with the same ones, whether or not it uses the extern
+ * templates; otherwise the linker keeps one of the differing
+ * definitions, which violates the ODR.  TCLAP_compiled is compiled with
+ * the default configuration and TCLAP_compiled_stats with
+ * TCLAP_PARSE_STATS, which each define for their users.  Nothing is
+ * declared when TCLAP_SETBASE_ZERO is defined or one of the start
+ * strings is customized, since no instantiations are compiled for them.
+ *
+ * StringConvert is not listed: apart from its stream buffers, which are
+ * only instantiated where used, its members are constexpr or member
+ * templates, which an explicit instantiation doesn't cover.
+ */
+
+#ifndef TCLAP_EXTERN_TEMPLATE
+#define TCLAP_EXTERN_TEMPLATE extern template
+#endif
+
+#define TCLAP_EXTERN_TEMPLATES_VALUE(T, C) \
+	TCLAP_EXTERN_TEMPLATE class ValueArg<T, C>; \
+	TCLAP_EXTERN_TEMPLATE class MultiArg<T, C>; \
+	TCLAP_EXTERN_TEMPLATE class UnlabeledValueArg<T, C>; \
+	TCLAP_EXTERN_TEMPLATE class UnlabeledMultiArg<T, C>;
+
+#define TCLAP_EXTERN_TEMPLATES_CHAR(C) \
+	TCLAP_EXTERN_TEMPLATE class StringPool<C>; \
+	TCLAP_EXTERN_TEMPLATE class ArgException<C>; \
+	TCLAP_EXTERN_TEMPLATE class ArgParseException<C>; \
+	TCLAP_EXTERN_TEMPLATE class CmdLineParseException<C>; \
+	TCLAP_EXTERN_TEMPLATE class SpecificationException<C>; \
+	TCLAP_EXTERN_TEMPLATE class Arg<C>; \
+	TCLAP_EXTERN_TEMPLATE class SwitchArg<C>; \
+	TCLAP_EXTERN_TEMPLATE class MultiSwitchArg<C>; \
+	TCLAP_EXTERN_TEMPLATE class XorHandler<C>; \
+	TCLAP_EXTERN_TEMPLATE class HelpVisitor<C>; \
+	TCLAP_EXTERN_TEMPLATE class HelpArg<C>; \
+	TCLAP_EXTERN_TEMPLATE class VersionVisitor<C>; \
+	TCLAP_EXTERN_TEMPLATE class IgnoreRestVisitor<C>; \
+	TCLAP_EXTERN_TEMPLATE class StdOutput<C>; \
+	TCLAP_EXTERN_TEMPLATE class CmdLine<C>; \
+	TCLAP_EXTERN_TEMPLATES_VALUE(std::basic_string<C>, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(int, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(long, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(long long, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(unsigned int, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(unsigned long, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(unsigned long long, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(float, C) \
+	TCLAP_EXTERN_TEMPLATES_VALUE(double, C)
+
+#if !defined(TCLAP_SETBASE_ZERO) && !defined(TCLAP_CUSTOM_START_STRINGS)
+namespace TCLAP {
+
+	TCLAP_EXTERN_TEMPLATES_CHAR(char)
+	TCLAP_EXTERN_TEMPLATES_CHAR(wchar_t)
+
+} //namespace TCLAP
+#endif
+
+#undef TCLAP_EXTERN_TEMPLATES_CHAR
+#undef TCLAP_EXTERN_TEMPLATES_VALUE
+
+#endif
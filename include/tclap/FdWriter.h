@@ -0,0 +1,73 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  FdWriter.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_FD_WRITER_H
+#define TCLAP_FD_WRITER_H
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace TCLAP {
+
+	/**
+	 * Writes to a file descriptor, for ConvertedOstreamBuf.  Kept apart
+	 * so that the system headers it needs are only included here.
+	 */
+	class FdWriter {
+	public:
+		/**
+		 * Writes all of the bytes with write(2), or _write on Windows,
+		 * again after an interrupted or partial write.  Returns whether
+		 * they were all written.
+		 * \param fd - The file descriptor to write.
+		 * \param p_mbs - The bytes to write.
+		 * \param size_mbs - The number of bytes.
+		 */
+		static bool write(int fd, const char* p_mbs, std::size_t size_mbs) noexcept {
+			while (size_mbs) {
+#ifdef _WIN32
+				int result_write = ::_write(fd, p_mbs, static_cast<unsigned int>(std::min<std::size_t>(size_mbs, INT_MAX)));
+#else
+				ssize_t result_write = ::write(fd, p_mbs, size_mbs);
+#endif
+				if (result_write < 0) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				p_mbs += result_write;
+				size_mbs -= static_cast<std::size_t>(result_write);
+			}
+			return true;
+		}
+	};
+
+} //namespace TCLAP
+
+#endif
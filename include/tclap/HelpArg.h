@@ -0,0 +1,162 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  HelpArg.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_HELP_ARG_H
+#define TCLAP_HELP_ARG_H
+
+#include <string>
+#include <vector>
+
+#include <tclap/StringConvert.h>
+#include <tclap/SwitchArg.h>
+#include <tclap/HelpVisitor.h>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class HelpArg;
+
+	/**
+	 * The switch that prints the help, created by CmdLine.  Besides
+	 * --help and -h it matches --help=section and -h=section, which
+	 * only print the Args in that section of the help (see
+	 * Arg::setSection).  A delimiter of the CmdLine other than a space
+	 * takes the place of '='.  When the delimiter is a space, the next
+	 * argument is also taken as the section when it names one and
+	 * doesn't match an Arg.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class HelpArg : public SwitchArg<T_Char, T_CharTraits, T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::CharType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
+		using typename SwitchArg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
+		using HelpVisitorType = HelpVisitor<T_Char, T_CharTraits, T_Alloc>;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::flagStartString;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::nameStartString;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::ignoreRest;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::delimiter;
+
+		/**
+		 * HelpArg constructor.
+		 * \param flag - The one character flag that identifies this
+		 * argument on the command line.
+		 * \param name - A one word name for the argument.  Can be
+		 * used as a long flag on the command line.
+		 * \param desc - A description of what the argument is for or
+		 * does.
+		 * \param v - The visitor that prints the help.
+		 */
+		HelpArg(const StringType& flag,
+			const StringType& name,
+			const DescriptionType& desc,
+			HelpVisitorType* v,
+			const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Handles --help=section and -h=section, and otherwise the processing of a
+		 * SwitchArg.
+		 * \param idx_arg - Pointer the the current argument in the list.
+		 * \param args - Mutable list of strings. Passed
+		 * in from main().
+		 */
+		virtual bool processArg(std::size_t& idx_arg, StringVectorType& args) override;
+
+		/**
+		 * The character between --help and the section in the same
+		 * argument: the delimiter of the CmdLine, or '=' when that is a
+		 * space.
+		 */
+		static CharType sectionDelimiter();
+
+	protected:
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::_flag;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::_name;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::_ignoreable;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::_visitor;
+		using SwitchArg<T_Char, T_CharTraits, T_Alloc>::commonProcessing;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN HelpArg.cpp
+	//////////////////////////////////////////////////////////////////////
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline HelpArg<T_Char, T_CharTraits, T_Alloc>::HelpArg(const StringType& flag,
+		const StringType& name,
+		const DescriptionType& desc,
+		HelpVisitorType* v,
+		const AllocatorType& alloc)
+		: SwitchArg<T_Char, T_CharTraits, T_Alloc>(flag, name, desc, false, v, alloc) {
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline bool HelpArg<T_Char, T_CharTraits, T_Alloc>::processArg(std::size_t& idx_arg, StringVectorType& args) {
+		if (_ignoreable && ignoreRest())
+			return false;
+
+		// --help=section or -h=section, or the section as the next
+		// argument when the delimiter is a space
+		StringViewType sv(args[idx_arg]);
+		StringViewType rest;
+		constexpr StringViewType strNameStart = nameStartString();
+		constexpr StringViewType strFlagStart = flagStartString();
+		if (sv.starts_with(strNameStart) && sv.substr(strNameStart.size()).starts_with(_name))
+			rest = sv.substr(strNameStart.size() + _name.size());
+		else if (!_flag.empty() && sv.starts_with(strFlagStart) && sv.substr(strFlagStart.size()).starts_with(_flag))
+			rest = sv.substr(strFlagStart.size() + _flag.size());
+		else
+			return SwitchArg<T_Char, T_CharTraits, T_Alloc>::processArg(idx_arg, args);
+
+		// The constructor only takes a HelpVisitor.
+		HelpVisitorType* visitor = static_cast<HelpVisitorType*>(_visitor);
+		bool hasSection = false;
+		if (!rest.empty() && rest.front() == sectionDelimiter()) {
+			if (visitor) visitor->setSection(rest.substr(1));
+			hasSection = true;
+		} else if (rest.empty() && delimiter() == StringConvertType::fromConstBasicChar(' ')
+			&& idx_arg + 1 < args.size() && visitor && visitor->isSection(args[idx_arg + 1])) {
+			visitor->setSection(args[++idx_arg]);
+			hasSection = true;
+		}
+		if (hasSection) {
+			commonProcessing();
+			return true;
+		}
+
+		return SwitchArg<T_Char, T_CharTraits, T_Alloc>::processArg(idx_arg, args);
+	}
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto HelpArg<T_Char, T_CharTraits, T_Alloc>::sectionDelimiter() -> CharType {
+		return delimiter() == StringConvertType::fromConstBasicChar(' ') ? StringConvertType::fromConstBasicChar('=') : delimiter();
+	}
+	//////////////////////////////////////////////////////////////////////
+	//End HelpArg.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
@@ -41,7 +41,8 @@ namespace TCLAP {
 
 	/**
 	 * A Visitor object that calls the usage method of the given CmdLineOutput
-	 * object for the specified CmdLine object.
+	 * object for the specified CmdLine object, or its sectionUsage method
+	 * when a section of the help was asked for with --help=section.
 	 */
 	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
 	class HelpVisitor : public UseAllocatorBase<T_Alloc>, public Visitor {
@@ -50,6 +51,8 @@ namespace TCLAP {
 		using typename UseAllocatorBase<T_Alloc>::AllocatorTraitsType;
 		using CmdLineInterfaceType = CmdLineInterface<T_Char, T_CharTraits, T_Alloc>;
 		using CmdLineOutputType = CmdLineOutput<T_Char, T_CharTraits, T_Alloc>;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -62,13 +65,58 @@ namespace TCLAP {
 		 * \param out - The type of output.
 		 */
 		HelpVisitor(CmdLineInterfaceType* cmd, CmdLineOutputType** out, const AllocatorType& alloc = AllocatorType())
-			: UseAllocatorBase<T_Alloc>(alloc), Visitor(), _cmd(cmd), _out(out) {}
+			: UseAllocatorBase<T_Alloc>(alloc), Visitor(), _cmd(cmd), _out(out), _section(alloc) {}
+
+		/**
+		 * Sets the section of the help that the next visit prints,
+		 * instead of the whole help.  Called by HelpArg.
+		 * \param section - The name of the section.
+		 */
+		void setSection(StringViewType section) { _section.assign(section); }
+
+		/**
+		 * Returns whether any Arg of the CmdLine is in a section of the
+		 * help.
+		 */
+		bool hasSections() const {
+			for (const auto* arg : _cmd->getArgList())
+				if (!arg->getSection().empty())
+					return true;
+			return false;
+		}
+
+		/**
+		 * Returns whether the argument after --help names a section of
+		 * the help.  That is only so when some Arg is in that section
+		 * and the argument doesn't match any Arg, so that "--help -v"
+		 * or "--help file" still print the whole help.
+		 * \param s - The argument after --help.
+		 */
+		bool isSection(const StringType& s) const {
+			bool found = false;
+			for (const auto* arg : _cmd->getArgList()) {
+				if (arg->argMatches(s))
+					return false;
+				if (arg->getSection() == StringViewType(s))
+					found = true;
+			}
+			return found;
+		}
 
 		/**
 		 * Calls the usage method of the CmdLineOutput for the
-		 * specified CmdLine.
+		 * specified CmdLine, or its sectionUsage method when a section
+		 * was set.  Exits with status 1 when no Arg is in the section.
 		 */
-		virtual void visit() override { (*_out)->usage(*_cmd); throw ExitException(0); }
+		virtual void visit() override {
+			bool found = true;
+			if (_section.empty())
+				(*_out)->usage(*_cmd);
+			else
+				found = (*_out)->sectionUsage(*_cmd, _section);
+			_section.clear();
+			throw ExitException(found ? 0 : 1);
+		}
 
 	protected:
 		/**
@@ -80,6 +128,11 @@ namespace TCLAP {
 		 * The output object.
 		 */
 		CmdLineOutputType** _out;
+
+		/**
+		 * The section of the help to print, or empty for all of it.
+		 */
+		StringType _section;
 	};
 
 }
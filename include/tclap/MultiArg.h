@@ -26,7 +26,9 @@
 #ifndef TCLAP_MULTIPLE_ARGUMENT_H
 #define TCLAP_MULTIPLE_ARGUMENT_H
 
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <tclap/StringConvert.h>
@@ -55,6 +57,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -66,6 +69,7 @@ namespace TCLAP {
 		using container_type = std::vector<T, typename std::allocator_traits<AllocatorType>::template rebind_alloc<T>>;
 		using iterator = typename container_type::iterator;
 		using const_iterator = typename container_type::const_iterator;
+		using ValueCallbackType = std::function<void(T&&)>;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 		using Arg<T_Char, T_CharTraits, T_Alloc>::addToList;
@@ -122,7 +126,7 @@ namespace TCLAP {
 		 */
 		MultiArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			const StringType& typeDesc,
 			Visitor* v = nullptr,
@@ -148,7 +152,7 @@ namespace TCLAP {
 		 */
 		MultiArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			const StringType& typeDesc,
 			CmdLineInterfaceType& parser,
@@ -172,7 +176,7 @@ namespace TCLAP {
 		 */
 		MultiArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			ConstraintType* constraint,
 			Visitor* v = nullptr,
@@ -196,7 +200,7 @@ namespace TCLAP {
 		 */
 		MultiArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			ConstraintType* constraint,
 			CmdLineInterfaceType& parser,
@@ -231,6 +235,29 @@ namespace TCLAP {
 		 */
 		const_iterator end() const { return _values.end(); }
 
+		/**
+		 * Streams the values: each one is passed to callback as soon as
+		 * it has been converted and checked instead of being kept, so
+		 * that processing can start during the parse and the values
+		 * don't have to fit in memory at once.  getValue() then stays
+		 * empty.  An empty callback keeps the values again.
+		 * \param callback - Called with each value.
+		 */
+		void setValueCallback(ValueCallbackType callback) { _valueCallback = std::move(callback); }
+
+		/**
+		 * Streams the values into an output iterator, see
+		 * setValueCallback.
+		 * \param out - Where the values are written.
+		 */
+		template<class T_OutputIt>
+		void streamTo(T_OutputIt out) { setValueCallback([out](T&& value) mutable { *out++ = std::move(value); }); }
+
+		/**
+		 * Returns the number of values parsed, whether kept or streamed.
+		 */
+		std::size_t getCount() const { return _count; }
+
 		/**
 		 * Returns the a short id string.  Used in the usage.
 		 * \param val - value to be used.
@@ -294,12 +321,22 @@ namespace TCLAP {
 		 * Used by XorHandler to decide whether to keep parsing for this arg.
 		 */
 		bool _allowMore;
+
+		/**
+		 * Receives the values instead of _values, when set.
+		 */
+		ValueCallbackType _valueCallback;
+
+		/**
+		 * The number of values parsed.
+		 */
+		std::size_t _count;
 	};
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	MultiArg<T, T_Char, T_CharTraits, T_Alloc>::MultiArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		const StringType& typeDesc,
 		Visitor* v,
@@ -308,14 +345,16 @@ namespace TCLAP {
 		_values(container_type()),
 		_typeDesc(typeDesc),
 		_constraint(nullptr),
-		_allowMore(false) {
+		_allowMore(false),
+		_valueCallback(),
+		_count(0) {
 		_acceptsMultipleValues = true;
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	MultiArg<T, T_Char, T_CharTraits, T_Alloc>::MultiArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		const StringType& typeDesc,
 		CmdLineInterfaceType& parser,
@@ -325,7 +364,9 @@ namespace TCLAP {
 		_values(container_type()),
 		_typeDesc(typeDesc),
 		_constraint(nullptr),
-		_allowMore(false) {
+		_allowMore(false),
+		_valueCallback(),
+		_count(0) {
 		parser.add(this);
 		_acceptsMultipleValues = true;
 	}
@@ -336,7 +377,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	MultiArg<T, T_Char, T_CharTraits, T_Alloc>::MultiArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		ConstraintType* constraint,
 		Visitor* v,
@@ -345,14 +386,16 @@ namespace TCLAP {
 		_values(container_type()),
 		_typeDesc(ConstraintType::shortID(constraint)),
 		_constraint(constraint),
-		_allowMore(false) {
+		_allowMore(false),
+		_valueCallback(),
+		_count(0) {
 		_acceptsMultipleValues = true;
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	MultiArg<T, T_Char, T_CharTraits, T_Alloc>::MultiArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		ConstraintType* constraint,
 		CmdLineInterfaceType& parser,
@@ -362,7 +405,9 @@ namespace TCLAP {
 		_values(container_type()),
 		_typeDesc(ConstraintType::shortID(constraint)),
 		_constraint(constraint),
-		_allowMore(false) {
+		_allowMore(false),
+		_valueCallback(),
+		_count(0) {
 		parser.add(this);
 		_acceptsMultipleValues = true;
 	}
@@ -416,7 +461,9 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	auto MultiArg<T, T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
 		static_cast<void>(val); // Ignore input, don't warn
-		return Arg<T_Char, T_CharTraits, T_Alloc>::shortID(_typeDesc) + StringConvertType::fromConstBasicCharString(" ...");
+		StringType id = Arg<T_Char, T_CharTraits, T_Alloc>::shortID(_typeDesc);
+		id += StringConvertType::template constBasicString<" ...">();
+		return id;
 	}
 
 	/**
@@ -425,7 +472,9 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	auto MultiArg<T, T_Char, T_CharTraits, T_Alloc>::longID(const StringType& val) const -> StringType {
 		static_cast<void>(val); // Ignore input, don't warn
-		return Arg<T_Char, T_CharTraits, T_Alloc>::longID(_typeDesc) + StringConvertType::fromConstBasicCharString("  (accepted multiple times)");
+		StringType id = Arg<T_Char, T_CharTraits, T_Alloc>::longID(_typeDesc);
+		id += StringConvertType::template constBasicString<"  (accepted multiple times)">();
+		return id;
 	}
 
 	/**
@@ -435,7 +484,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	bool MultiArg<T, T_Char, T_CharTraits, T_Alloc>::isRequired() const {
 		if (_required) 	{
-			if (_values.size() > 1)
+			if (_count > 1)
 				return false;
 			else
 				return true;
@@ -446,20 +495,32 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	void MultiArg<T, T_Char, T_CharTraits, T_Alloc>::_extractValue(const StringType& val) {
+		T tmp;
 		try {
-			T tmp;
+			TCLAP_PARSE_STATS_TIME(extractionNs);
+			TCLAP_PARSE_STATS_COUNT(conversions, 1);
 			ExtractValue(tmp, val, typename ArgTraits<T>::ValueCategory());
-			_values.push_back(tmp);
 		} catch (ArgParseException<T_Char, T_CharTraits, T_Alloc>& e) {
 			throw ArgParseException<T_Char, T_CharTraits, T_Alloc>(e.error(), toString());
 		}
 
-		if (_constraint)
-			if (!_constraint->check(_values.back()))
+		if (_constraint) {
+			TCLAP_PARSE_STATS_TIME(validationNs);
+			TCLAP_PARSE_STATS_COUNT(constraintChecks, 1);
+			if (!_constraint->check(tmp))
 				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(
 					StringConvertType::fromConstBasicCharString("Value \'") + val + StringConvertType::fromConstBasicCharString("\' does not meet constraint: ") + _constraint->description(),
 					toString()
 					));
+		}
+
+		ParseEventSink<T_Char, T_CharTraits, T_Alloc>::valueConverted(*this, val);
+
+		_count++;
+		if (_valueCallback)
+			_valueCallback(std::move(tmp));
+		else
+			_values.push_back(std::move(tmp));
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
@@ -473,6 +534,7 @@ namespace TCLAP {
 	void MultiArg<T, T_Char, T_CharTraits, T_Alloc>::reset() {
 		Arg<T_Char, T_CharTraits, T_Alloc>::reset();
 		_values.clear();
+		_count = 0;
 	}
 
 } // namespace TCLAP
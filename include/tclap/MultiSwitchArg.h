@@ -53,6 +53,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -114,7 +115,7 @@ namespace TCLAP {
 		 */
 		MultiSwitchArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			std::size_t init = 0,
 			Visitor* v = nullptr,
 			const AllocatorType& alloc = AllocatorType());
@@ -136,7 +137,7 @@ namespace TCLAP {
 		 */
 		MultiSwitchArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			CmdLineInterfaceType& parser,
 			std::size_t init = 0,
 			Visitor* v = nullptr,
@@ -202,7 +203,7 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline MultiSwitchArg<T_Char, T_CharTraits, T_Alloc>::MultiSwitchArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		std::size_t init,
 		Visitor* v,
 		const AllocatorType& alloc)
@@ -214,7 +215,7 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline MultiSwitchArg<T_Char, T_CharTraits, T_Alloc>::MultiSwitchArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		CmdLineInterfaceType& parser,
 		std::size_t init,
 		Visitor* v,
@@ -246,10 +247,16 @@ namespace TCLAP {
 
 			// Matched argument: increment value.
 			++_value;
+			ParseEventSink<T_Char, T_CharTraits, T_Alloc>::argMatchedInCombined(*this);
 
-			// Check for more in argument and increment value.
-			while (combinedSwitchesMatch(args[idx_arg]))
-				++_value;
+			// Check for more in argument and increment value, in one pass
+			// rather than rescanning the token for each copy.
+			for (CharType& ch : args[idx_arg])
+				if (ch == _flag.front()) {
+					ch = Arg<T_Char, T_CharTraits, T_Alloc>::blankChar();
+					++_value;
+					ParseEventSink<T_Char, T_CharTraits, T_Alloc>::argMatchedInCombined(*this);
+				}
 
 			_checkWithVisitor();
 
@@ -261,13 +268,17 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto
 		MultiSwitchArg<T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
-		return Arg<T_Char, T_CharTraits, T_Alloc>::shortID(val) + StringConvertType::fromConstBasicCharString(" ...");
+		StringType id = Arg<T_Char, T_CharTraits, T_Alloc>::shortID(val);
+		id += StringConvertType::template constBasicString<" ...">();
+		return id;
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto
 		MultiSwitchArg<T_Char, T_CharTraits, T_Alloc>::longID(const StringType& val) const -> StringType {
-		return Arg<T_Char, T_CharTraits, T_Alloc>::longID(val) + StringConvertType::fromConstBasicCharString("  (accepted multiple times)");
+		StringType id = Arg<T_Char, T_CharTraits, T_Alloc>::longID(val);
+		id += StringConvertType::template constBasicString<"  (accepted multiple times)">();
+		return id;
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
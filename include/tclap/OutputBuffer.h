@@ -0,0 +1,146 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  OutputBuffer.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_OUTPUTBUFFER_H
+#define TCLAP_OUTPUTBUFFER_H
+
+#include <cstddef>
+#include <charconv>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <tclap/UseAllocatorBase.h>
+#include <tclap/StringConvert.h>
+
+namespace TCLAP {
+	/**
+	 * A growable buffer that the output classes render a whole document
+	 * into, with the same operator<< as a stream but none of its
+	 * formatting state, locale or per-insertion sentry.  The finished
+	 * document is then either written to a stream with a single write, or
+	 * handed to the caller with release().
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class OutputBuffer : public UseAllocatorBase<T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using StringConvertType = StringConvert<T_Char, T_CharTraits>;
+		using OstreamType = std::basic_ostream<T_Char, T_CharTraits>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+
+		explicit OutputBuffer(const AllocatorType& alloc = AllocatorType())
+			: UseAllocatorBase<T_Alloc>(alloc),
+			_str(alloc) {
+		}
+
+		OutputBuffer& operator<<(StringViewType s) {
+			_str += s;
+			return *this;
+		}
+
+		OutputBuffer& operator<<(CharType ch) {
+			_str += ch;
+			return *this;
+		}
+
+		/**
+		 * Appends the decimal digits of an integer, formatted with
+		 * std::to_chars.  Character types are excluded, so that a
+		 * CharType isn't printed as a number.
+		 */
+		template<typename T_Int>
+			requires (std::is_integral_v<T_Int> && !std::is_same_v<T_Int, bool> &&
+				!std::is_same_v<T_Int, char> && !std::is_same_v<T_Int, wchar_t> && !std::is_same_v<T_Int, char8_t> &&
+				!std::is_same_v<T_Int, char16_t> && !std::is_same_v<T_Int, char32_t>)
+		OutputBuffer& operator<<(T_Int n) {
+			char arr_digits[std::numeric_limits<T_Int>::digits10 + 3];
+			std::to_chars_result result = std::to_chars(arr_digits, arr_digits + sizeof(arr_digits), n);
+			for (const char* p = arr_digits; p != result.ptr; ++p)
+				_str += StringConvertType::fromConstBasicChar(*p);
+			return *this;
+		}
+
+		/**
+		 * Appends count copies of ch.
+		 */
+		OutputBuffer& append(std::size_t count, CharType ch) {
+			_str.append(count, ch);
+			return *this;
+		}
+
+		/**
+		 * Takes the manipulators of an ostream, so that rendering code can
+		 * be shared with streams.  std::endl appends the end of a line
+		 * without flushing, and the others do nothing: the buffer is
+		 * flushed once, by writeTo.
+		 */
+		OutputBuffer& operator<<(OstreamType& (*manip)(OstreamType&)) {
+			if (manip == static_cast<OstreamType& (*)(OstreamType&)>(&std::endl<T_Char, T_CharTraits>))
+				_str += StringConvertType::fromConstBasicChar('\n');
+			return *this;
+		}
+
+		void reserve(std::size_t size) { _str.reserve(size); }
+		std::size_t size() const { return _str.size(); }
+		bool empty() const { return _str.empty(); }
+		void clear() { _str.clear(); }
+
+		/**
+		 * Returns the document rendered so far.
+		 */
+		StringViewType view() const { return _str; }
+
+		/**
+		 * Hands the document over to the caller, leaving the buffer empty.
+		 */
+		StringType release() {
+			StringType str(std::move(_str));
+			_str.clear();
+			return str;
+		}
+
+		/**
+		 * Writes the document to os with a single write, flushes os and
+		 * empties the buffer, keeping its capacity.
+		 */
+		void writeTo(OstreamType& os) {
+			os.write(_str.data(), static_cast<std::streamsize>(_str.size()));
+			os.flush();
+			_str.clear();
+		}
+
+	private:
+		StringType _str;
+	};
+
+} //namespace TCLAP
+
+#endif
@@ -0,0 +1,230 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ParseEvent.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_PARSE_EVENT_H
+#define TCLAP_PARSE_EVENT_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class Arg;
+
+	/**
+	 * What a ParseEvent reports.
+	 */
+	enum class ParseEventKind {
+		/**
+		 * An Arg matched the tokens of the event.  Each switch of a
+		 * combined switch token gets its own event, whose token is the
+		 * flag of the switch, and a MultiSwitchArg gets one for each
+		 * time its flag appears.  These events come in the order the
+		 * Args are offered the token, which is that of
+		 * CmdLine::getArgList, not in the order of the flags: if v comes
+		 * before x in the list, "-xvv" reports v, v and then x.
+		 */
+		ArgMatched,
+
+		/**
+		 * An Arg converted a value.  The token of the event is the text
+		 * of the value, which is part of a token when the value follows
+		 * a delimiter other than a space.  The values of an Arg are
+		 * converted while it matches, so they come before its
+		 * ArgMatched event.
+		 */
+		ValueConverted,
+
+		/**
+		 * No Arg matched the token of the event, which was skipped
+		 * because of CmdLine::ignoreUnmatched or the ignore rest flag.
+		 */
+		Unmatched
+	};
+
+	/**
+	 * An event of a parse.  The views of an event refer to the
+	 * command line being parsed and are only valid during the call that
+	 * receives it.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	struct ParseEvent {
+		using ArgType = Arg<T_Char, T_CharTraits, T_Alloc>;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+
+		ParseEventKind kind;
+
+		/**
+		 * The Arg that matched or converted, or null when unmatched.
+		 */
+		const ArgType* arg;
+
+		/**
+		 * The index in argv of the first token of the event, the program
+		 * name being 0.
+		 */
+		std::size_t tokenIndex;
+
+		/**
+		 * The number of tokens of the event.
+		 */
+		std::size_t tokenCount;
+
+		/**
+		 * The first token of the event, the text of the value or the
+		 * flag of a combined switch.
+		 */
+		StringViewType token;
+	};
+
+	/**
+	 * Receives the events of the parses of a CmdLine, in the order the
+	 * command line is processed, see CmdLine::setEventSink.  Unlike a
+	 * Visitor, a sink is told which Arg matched which tokens, so an
+	 * audit log or side effects can be driven in the same pass as the
+	 * parse.  Events are passed on the stack, so the only allocations
+	 * are those of the sink.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class ParseEventSink {
+	public:
+		using ArgType = Arg<T_Char, T_CharTraits, T_Alloc>;
+		using EventType = ParseEvent<T_Char, T_CharTraits, T_Alloc>;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using StringVectorType = std::vector<StringType, typename std::allocator_traits<T_Alloc>::template rebind_alloc<StringType>>;
+
+		virtual ~ParseEventSink() {}
+
+		/**
+		 * Receives an event.  An exception thrown here ends the parse.
+		 * \param e - The event.
+		 */
+		virtual void event(const EventType& e) = 0;
+
+		/**
+		 * The state of the parse running on this thread.
+		 */
+		struct Context {
+			ParseEventSink* sink = nullptr;
+			const StringVectorType* args = nullptr;
+
+			/**
+			 * The index in args of the token being matched.
+			 */
+			std::size_t first = 0;
+
+			/**
+			 * Whether an Arg already reported matching that token.
+			 */
+			bool matched = false;
+		};
+
+		static Context& context() { static thread_local Context c; return c; }
+
+		/**
+		 * Called by the switches matched in a combined switch token,
+		 * which CmdLine can't tell apart, as each of them matches.  The
+		 * token has already been blanked where the switch was.
+		 * \param a - The switch.
+		 */
+		static void argMatchedInCombined(const ArgType& a) {
+			Context& c = context();
+			if (!c.sink) return;
+			c.matched = true;
+			c.sink->event(EventType{ParseEventKind::ArgMatched, &a, c.first + 1, 1, a.getFlag()});
+		}
+
+		/**
+		 * Called by the Args that convert values.
+		 * \param a - The Arg.
+		 * \param val - The text of the value, a token or part of one.
+		 */
+		static void valueConverted(const ArgType& a, const StringType& val) {
+			Context& c = context();
+			if (!c.sink) return;
+			// A value that is a whole token is one of the args, any other
+			// one was split from the token being matched.
+			std::size_t idx = c.first;
+			const StringType* begin = c.args->data();
+			const StringType* end = begin + c.args->size();
+			if (!std::less<const StringType*>()(&val, begin) && std::less<const StringType*>()(&val, end))
+				idx = static_cast<std::size_t>(&val - begin);
+			c.sink->event(EventType{ParseEventKind::ValueConverted, &a, idx + 1, 1, val});
+		}
+	};
+
+	/**
+	 * Makes sink, which may be null, the sink of the parse running on
+	 * this thread until destroyed.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class ParseEventScope {
+	public:
+		using SinkType = ParseEventSink<T_Char, T_CharTraits, T_Alloc>;
+
+		ParseEventScope(SinkType* sink, const typename SinkType::StringVectorType& args)
+			: _previous(SinkType::context()) {
+			SinkType::context() = typename SinkType::Context{sink, &args, 0, false};
+		}
+		~ParseEventScope() { SinkType::context() = _previous; }
+		ParseEventScope(const ParseEventScope&) = delete;
+		ParseEventScope& operator=(const ParseEventScope&) = delete;
+	private:
+		typename SinkType::Context _previous;
+	};
+
+	/**
+	 * A sink calling a callable with each event.
+	 */
+	template<class T_Callable, typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class CallbackParseEventSink : public ParseEventSink<T_Char, T_CharTraits, T_Alloc> {
+	public:
+		using typename ParseEventSink<T_Char, T_CharTraits, T_Alloc>::EventType;
+
+		explicit CallbackParseEventSink(T_Callable callable) : _callable(std::move(callable)) {}
+
+		virtual void event(const EventType& e) override { _callable(e); }
+
+	private:
+		T_Callable _callable;
+	};
+
+	/**
+	 * Returns a sink calling callable with each event, for example
+	 * makeParseEventSink<char>([](const ParseEvent<char>& e) { ... }).
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>, class T_Callable>
+	CallbackParseEventSink<T_Callable, T_Char, T_CharTraits, T_Alloc> makeParseEventSink(T_Callable callable) {
+		return CallbackParseEventSink<T_Callable, T_Char, T_CharTraits, T_Alloc>(std::move(callable));
+	}
+
+} //namespace TCLAP
+
+#endif
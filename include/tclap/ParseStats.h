@@ -0,0 +1,166 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  ParseStats.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_PARSE_STATS_H
+#define TCLAP_PARSE_STATS_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace TCLAP {
+
+	/**
+	 * Counts what CmdLine::parse does and times its phases, for finding
+	 * out why a parse is slow.  The statistics are only gathered when
+	 * TCLAP_PARSE_STATS is defined before including the headers;
+	 * otherwise the instrumentation compiles to nothing.  Attach one with
+	 * CmdLine::setParseStats.  Each parse adds to the counters, so call
+	 * reset() to measure a single one.
+	 *
+	 * The four times are disjoint: matching doesn't include the
+	 * extraction and validation done while an Arg processes a token.
+	 */
+	struct ParseStats {
+		/**
+		 * Tokens of the command line, not counting the program name.
+		 */
+		std::uint64_t tokens = 0;
+
+		/**
+		 * Calls of Arg::processArg.
+		 */
+		std::uint64_t processArgCalls = 0;
+
+		/**
+		 * Comparisons of a token with the flag or name of an Arg.
+		 */
+		std::uint64_t stringComparisons = 0;
+
+		/**
+		 * Values converted from a token.
+		 */
+		std::uint64_t conversions = 0;
+
+		/**
+		 * Values checked against a Constraint.
+		 */
+		std::uint64_t constraintChecks = 0;
+
+		/**
+		 * ArgExceptions and ExitExceptions that ended a parse.
+		 */
+		std::uint64_t exceptions = 0;
+
+		/**
+		 * Time spent copying argv into strings.
+		 */
+		std::uint64_t tokenizationNs = 0;
+
+		/**
+		 * Time spent offering the tokens to the Args.
+		 */
+		std::uint64_t matchingNs = 0;
+
+		/**
+		 * Time spent converting values.
+		 */
+		std::uint64_t extractionNs = 0;
+
+		/**
+		 * Time spent checking constraints, xor groups and required Args.
+		 */
+		std::uint64_t validationNs = 0;
+
+		/**
+		 * Zeroes every counter.
+		 */
+		void reset() { *this = ParseStats(); }
+
+		/**
+		 * The statistics of the parse running on this thread, or null.
+		 */
+		static ParseStats*& current() { static thread_local ParseStats* stats = nullptr; return stats; }
+	};
+
+	/**
+	 * Makes stats the current ParseStats of the thread until destroyed.
+	 * A null stats leaves the current one, so that a nested parse, such
+	 * as that of a subcommand, adds to the statistics of the outer one.
+	 */
+	class ParseStatsScope {
+	public:
+		explicit ParseStatsScope(ParseStats* stats) : _previous(ParseStats::current()) {
+			if (stats) ParseStats::current() = stats;
+		}
+		~ParseStatsScope() { ParseStats::current() = _previous; }
+		ParseStatsScope(const ParseStatsScope&) = delete;
+		ParseStatsScope& operator=(const ParseStatsScope&) = delete;
+	private:
+		ParseStats* _previous;
+	};
+
+	/**
+	 * Adds the time until destroyed to a field of the current
+	 * ParseStats, less the time of the timers nested in it.
+	 */
+	class ParseStatsTimer {
+	public:
+		explicit ParseStatsTimer(std::uint64_t ParseStats::* field)
+			: _stats(ParseStats::current()), _field(field), _parent(nullptr), _nestedNs(0), _start() {
+			if (!_stats) return;
+			_parent = innermost();
+			innermost() = this;
+			_start = std::chrono::steady_clock::now();
+		}
+		~ParseStatsTimer() {
+			if (!_stats) return;
+			std::uint64_t ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+			_stats->*_field += ns - _nestedNs;
+			if (_parent) _parent->_nestedNs += ns;
+			innermost() = _parent;
+		}
+		ParseStatsTimer(const ParseStatsTimer&) = delete;
+		ParseStatsTimer& operator=(const ParseStatsTimer&) = delete;
+	private:
+		static ParseStatsTimer*& innermost() { static thread_local ParseStatsTimer* timer = nullptr; return timer; }
+
+		ParseStats* _stats;
+		std::uint64_t ParseStats::* _field;
+		ParseStatsTimer* _parent;
+		std::uint64_t _nestedNs;
+		std::chrono::steady_clock::time_point _start;
+	};
+
+} //namespace TCLAP
+
+#ifdef TCLAP_PARSE_STATS
+#define TCLAP_PARSE_STATS_SCOPE(stats) ::TCLAP::ParseStatsScope tclap_parse_stats_scope(stats)
+#define TCLAP_PARSE_STATS_TIME(field) ::TCLAP::ParseStatsTimer tclap_parse_stats_timer_##field(&::TCLAP::ParseStats::field)
+#define TCLAP_PARSE_STATS_COUNT(field, n) do { if (::TCLAP::ParseStats* tclap_parse_stats = ::TCLAP::ParseStats::current()) tclap_parse_stats->field += (n); } while (false)
+#else
+#define TCLAP_PARSE_STATS_SCOPE(stats) ((void)0)
+#define TCLAP_PARSE_STATS_TIME(field) ((void)0)
+#define TCLAP_PARSE_STATS_COUNT(field, n) ((void)0)
+#endif
+
+#endif
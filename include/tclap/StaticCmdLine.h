@@ -0,0 +1,509 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  StaticCmdLine.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_STATIC_CMDLINE_H
+#define TCLAP_STATIC_CMDLINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tclap/StringConvert.h>
+#include <tclap/DecodedArgv.h>
+#include <tclap/ArgException.h>
+#include <tclap/Arg.h>
+
+namespace TCLAP {
+
+	/**
+	 * A perfect hash table over a fixed set of strings, built at compile
+	 * time with the hash and displace method.  Keys are first hashed into
+	 * buckets, and each bucket gets a seed that places all of its keys in
+	 * free slots.  A lookup costs two hashes and one comparison.  Empty
+	 * keys are left out.  Equal keys are a specification error, which is
+	 * reported at compile time when the table is built in a constant
+	 * expression.
+	 */
+	template<std::size_t N, typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
+	class StaticNameTable {
+	public:
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		constexpr StaticNameTable(const std::array<StringViewType, N>& keys);
+
+		/**
+		 * Returns the index of s among the keys, or npos.
+		 */
+		constexpr std::size_t find(StringViewType s) const {
+			if constexpr (N == 0) {
+				return npos;
+			} else {
+				std::size_t idx = _slots[_hash(s, _seeds[_hash(s, 0) % _countBuckets]) % _countSlots];
+				return (idx != 0 && _keys[idx - 1] == s) ? idx - 1 : npos;
+			}
+		}
+
+		/**
+		 * Returns the key at index i.
+		 */
+		constexpr StringViewType key(std::size_t i) const { return _keys[i]; }
+
+	private:
+		static constexpr std::size_t _countBuckets = N ? N : 1;
+		static constexpr std::size_t _countSlots = 2 * _countBuckets;
+
+		static constexpr std::uint32_t _hash(StringViewType s, std::uint32_t seed) {
+			std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+			for (const T_Char& ch : s) {
+				h ^= static_cast<std::uint32_t>(T_CharTraits::to_int_type(ch));
+				h *= 16777619u;
+			}
+			h ^= h >> 15;
+			return h;
+		}
+
+		std::array<StringViewType, N> _keys;
+		std::array<std::uint32_t, _countBuckets> _seeds;
+		std::array<std::size_t, _countSlots> _slots;
+	};
+
+	template<std::size_t N, typename T_Char, typename T_CharTraits>
+	constexpr StaticNameTable<N, T_Char, T_CharTraits>::StaticNameTable(const std::array<StringViewType, N>& keys)
+		: _keys(keys), _seeds(), _slots() {
+		// Group the keys by bucket once, with a counting sort, so that
+		// keys[byBucket[startBucket[b]] .. byBucket[startBucket[b + 1] - 1]]
+		// are the keys of bucket b.
+		std::array<std::size_t, N> bucketKey{};
+		std::array<std::size_t, _countBuckets + 1> startBucket{};
+		for (std::size_t i = 0; i < N; i++) {
+			if (keys[i].empty()) continue;
+			bucketKey[i] = _hash(keys[i], 0) % _countBuckets;
+			startBucket[bucketKey[i] + 1]++;
+		}
+		for (std::size_t b = 0; b < _countBuckets; b++) startBucket[b + 1] += startBucket[b];
+		std::array<std::size_t, N> byBucket{};
+		std::array<std::size_t, _countBuckets> fill{};
+		for (std::size_t b = 0; b < _countBuckets; b++) fill[b] = startBucket[b];
+		for (std::size_t i = 0; i < N; i++)
+			if (!keys[i].empty()) byBucket[fill[bucketKey[i]]++] = i;
+
+		// Equal keys share a bucket, and buckets hold few keys, so they
+		// are only compared within their bucket.  Otherwise they would
+		// never find free slots.
+		for (std::size_t b = 0; b < _countBuckets; b++)
+			for (std::size_t k = startBucket[b]; k < startBucket[b + 1]; k++)
+				for (std::size_t l = startBucket[b]; l < k; l++)
+					if (keys[byBucket[k]] == keys[byBucket[l]])
+						throw(SpecificationException<T_Char, T_CharTraits>(StringConvert<T_Char, T_CharTraits>::fromConstBasicCharString("Argument with same flag/name already exists!"), std::basic_string<T_Char, T_CharTraits>(keys[byBucket[k]])));
+
+		// Place the biggest buckets first, while most slots are free.
+		// The buckets are ordered by size with a counting sort too.
+		std::array<std::size_t, N + 2> startSize{};
+		for (std::size_t b = 0; b < _countBuckets; b++) startSize[N - (startBucket[b + 1] - startBucket[b]) + 1]++;
+		for (std::size_t size = 0; size <= N; size++) startSize[size + 1] += startSize[size];
+		std::array<std::size_t, _countBuckets> buckets{};
+		for (std::size_t b = 0; b < _countBuckets; b++) buckets[startSize[N - (startBucket[b + 1] - startBucket[b])]++] = b;
+		std::array<std::size_t, N> slotsBucket{};
+		for (std::size_t b : buckets) {
+			std::size_t first = startBucket[b];
+			std::size_t size = startBucket[b + 1] - first;
+			if (size == 0) break;
+			for (std::uint32_t seed = 1;; seed++) {
+				std::size_t countPlaced = 0;
+				for (; countPlaced < size; countPlaced++) {
+					std::size_t slot = _hash(keys[byBucket[first + countPlaced]], seed) % _countSlots;
+					if (_slots[slot] != 0 || std::find(slotsBucket.begin(), slotsBucket.begin() + countPlaced, slot) != slotsBucket.begin() + countPlaced)
+						break;
+					slotsBucket[countPlaced] = slot;
+				}
+				if (countPlaced == size) {
+					for (std::size_t k = 0; k < size; k++) _slots[slotsBucket[k]] = byBucket[first + k] + 1;
+					_seeds[b] = seed;
+					break;
+				}
+			}
+		}
+	}
+
+	/**
+	 * A value option of a StaticCmdLine.  Sets a member of the result.
+	 */
+	template<typename T_Result, typename T, typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
+	struct StaticValueArg {
+		using ResultType = T_Result;
+		using ValueType = T;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		static constexpr bool isSwitch = false;
+		static constexpr bool isMulti = false;
+
+		StringViewType flag;
+		StringViewType name;
+		StringViewType desc;
+		StringViewType typeDesc;
+		bool required;
+		T T_Result::* member;
+
+		template<typename T_Alloc>
+		void set(T_Result& result, const std::basic_string<T_Char, T_CharTraits, T_Alloc>& val) const {
+			ExtractValue(result.*member, val, typename ArgTraits<T>::ValueCategory());
+		}
+	};
+
+	/**
+	 * A multi value option of a StaticCmdLine.  Appends to a vector
+	 * member of the result.
+	 */
+	template<typename T_Result, typename T, typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
+	struct StaticMultiArg {
+		using ResultType = T_Result;
+		using ValueType = T;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		static constexpr bool isSwitch = false;
+		static constexpr bool isMulti = true;
+
+		StringViewType flag;
+		StringViewType name;
+		StringViewType desc;
+		StringViewType typeDesc;
+		bool required;
+		std::vector<T> T_Result::* member;
+
+		template<typename T_Alloc>
+		void set(T_Result& result, const std::basic_string<T_Char, T_CharTraits, T_Alloc>& val) const {
+			T value;
+			ExtractValue(value, val, typename ArgTraits<T>::ValueCategory());
+			(result.*member).push_back(std::move(value));
+		}
+	};
+
+	/**
+	 * A switch of a StaticCmdLine.  Sets a bool member of the result to
+	 * true.
+	 */
+	template<typename T_Result, typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
+	struct StaticSwitchArg {
+		using ResultType = T_Result;
+		using ValueType = bool;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		static constexpr bool isSwitch = true;
+		static constexpr bool isMulti = false;
+
+		StringViewType flag;
+		StringViewType name;
+		StringViewType desc;
+		StringViewType typeDesc;
+		bool required;
+		bool T_Result::* member;
+
+		void set(T_Result& result) const { result.*member = true; }
+	};
+
+	/**
+	 * Returns a StaticValueArg.  The default is the initial value of the
+	 * member in a value-initialized result.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Result, typename T>
+	constexpr StaticValueArg<T_Result, T, T_Char, T_CharTraits> staticValueArg(
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> flag,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> name,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> desc,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> typeDesc,
+		T T_Result::* member,
+		bool req = false) {
+		return { flag, name, desc, typeDesc, req, member };
+	}
+
+	/**
+	 * Returns a StaticMultiArg.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Result, typename T>
+	constexpr StaticMultiArg<T_Result, T, T_Char, T_CharTraits> staticMultiArg(
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> flag,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> name,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> desc,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> typeDesc,
+		std::vector<T> T_Result::* member,
+		bool req = false) {
+		return { flag, name, desc, typeDesc, req, member };
+	}
+
+	/**
+	 * Returns a StaticSwitchArg.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Result>
+	constexpr StaticSwitchArg<T_Result, T_Char, T_CharTraits> staticSwitchArg(
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> flag,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> name,
+		std::type_identity_t<std::basic_string_view<T_Char, T_CharTraits>> desc,
+		bool T_Result::* member) {
+		return { flag, name, desc, std::basic_string_view<T_Char, T_CharTraits>(), false, member };
+	}
+
+	/**
+	 * One option of a StaticArgStore, tagged with its index.
+	 */
+	template<std::size_t I, typename T_Arg>
+	struct StaticArgLeaf {
+		T_Arg arg;
+	};
+
+	template<typename T_Indices, typename... T_Args>
+	struct StaticArgStore;
+
+	/**
+	 * Holds the options of a StaticCmdLine.  Every option is a base of
+	 * its own, so the store is flat rather than nested like std::tuple,
+	 * which keeps the cost of compiling it linear in the number of
+	 * options.
+	 */
+	template<std::size_t... Is, typename... T_Args>
+	struct StaticArgStore<std::index_sequence<Is...>, T_Args...> : StaticArgLeaf<Is, T_Args>... {
+		constexpr explicit StaticArgStore(const T_Args&... args) : StaticArgLeaf<Is, T_Args>{ args }... {}
+	};
+
+	/**
+	 * A parser for a fixed set of options that is built at compile time.
+	 * The options are a list of StaticValueArg, StaticMultiArg and
+	 * StaticSwitchArg, which store into members of a result struct.  The
+	 * flags and names are looked up in perfect hash tables, and the option
+	 * is dispatched to without virtual calls.  Duplicate flags or names
+	 * fail to compile when the StaticCmdLine is declared constexpr.
+	 *
+	 * Unlike CmdLine, there are no unlabeled args, no help or version
+	 * switches and no output; errors are thrown as ArgExceptions.  A
+	 * trailing "--" is accepted, but any argument after it is rejected
+	 * as unmatched.
+	 */
+	template<typename T_Result, typename T_Char, typename T_CharTraits, typename T_Alloc, typename... T_Args>
+	class StaticCmdLine {
+	public:
+		using ResultType = T_Result;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using AllocatorType = T_Alloc;
+		using StringConvertType = StringConvert<T_Char, T_CharTraits>;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using NameTableType = StaticNameTable<sizeof...(T_Args), T_Char, T_CharTraits>;
+
+		constexpr explicit StaticCmdLine(const T_Args&... args)
+			: _args(args...),
+			_required{ args.required... },
+			_flags(std::array<StringViewType, sizeof...(T_Args)>{ args.flag... }),
+			_names(std::array<StringViewType, sizeof...(T_Args)>{ args.name... }) {
+		}
+
+		/**
+		 * Returns the number of options.
+		 */
+		static constexpr std::size_t count() { return sizeof...(T_Args); }
+
+		/**
+		 * Parses the command line into a value-initialized result.
+		 * \param argc - Number of arguments.
+		 * \param argv - Array of arguments.  argv[0] is the program name.
+		 */
+		ResultType parse(int argc, const CharType* const* argv) const;
+
+		/**
+		 * Parses the native narrow argv of main, for a StaticCmdLine of
+		 * another character type.  The arguments are decoded into one arena
+		 * (see DecodedArgv), and parsed as views of it.
+		 * \param argc - Number of arguments.
+		 * \param argv - Array of arguments.  argv[0] is the program name.
+		 */
+		ResultType parse(int argc, const char* const* argv) const requires (!std::is_same_v<T_Char, char>);
+
+	private:
+		static constexpr std::array _arrFlagStart = StringConvertType::fromConstBasicCharArray(TCLAP_FLAGSTARTSTRING);
+		static constexpr std::array _arrNameStart = StringConvertType::fromConstBasicCharArray(TCLAP_NAMESTARTSTRING);
+
+		/**
+		 * Whether each option is a switch.
+		 */
+		static constexpr std::array<bool, sizeof...(T_Args)> _isSwitch = { T_Args::isSwitch... };
+
+		/**
+		 * Whether each option may be given more than once.
+		 */
+		static constexpr std::array<bool, sizeof...(T_Args)> _isMulti = { T_Args::isMulti... };
+
+		/**
+		 * Stores an option, and its value if it takes one.  Instantiated
+		 * once per type of option rather than once per option.
+		 */
+		template<typename T_Arg>
+		static void _processArg(const T_Arg& arg, ResultType& result, int& idx_arg, int argc, const CharType* const* argv, StringViewType token);
+
+		using ProcessType = void (*)(const StaticCmdLine& cmd, ResultType& result, int& idx_arg, int argc, const CharType* const* argv, StringViewType token);
+
+		/**
+		 * Stores the option at index I, which is of type T_Arg.
+		 */
+		template<std::size_t I, typename T_Arg>
+		static void _process(const StaticCmdLine& cmd, ResultType& result, int& idx_arg, int argc, const CharType* const* argv, StringViewType token) {
+			_processArg(static_cast<const StaticArgLeaf<I, T_Arg>&>(cmd._args).arg, result, idx_arg, argc, argv, token);
+		}
+
+		/**
+		 * Returns the _process function of every option, so that an
+		 * option is dispatched to with one indirect call.
+		 */
+		template<std::size_t... Is>
+		static constexpr std::array<ProcessType, sizeof...(T_Args)> _makeProcessTable(std::index_sequence<Is...>) { return { &_process<Is, T_Args>... }; }
+
+		StaticArgStore<std::index_sequence_for<T_Args...>, T_Args...> _args;
+		std::array<bool, sizeof...(T_Args)> _required;
+		NameTableType _flags;
+		NameTableType _names;
+	};
+
+	/**
+	 * Returns a StaticCmdLine for the options in args.
+	 */
+	template<typename T_Alloc = void, typename T_Arg, typename... T_Args>
+	constexpr auto makeStaticCmdLine(const T_Arg& arg, const T_Args&... args) {
+		using CharType = typename T_Arg::CharType;
+		using AllocatorType = std::conditional_t<std::is_void_v<T_Alloc>, std::allocator<CharType>, T_Alloc>;
+		static_assert((std::is_same_v<typename T_Arg::ResultType, typename T_Args::ResultType> && ...), "All options must store into the same result type");
+		static_assert((std::is_same_v<CharType, typename T_Args::CharType> && ...), "All options must use the same character type");
+		return StaticCmdLine<typename T_Arg::ResultType, CharType, typename T_Arg::CharTraitsType, AllocatorType, T_Arg, T_Args...>(arg, args...);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN StaticCmdLine.cpp
+	//////////////////////////////////////////////////////////////////////
+
+	template<typename T_Result, typename T_Char, typename T_CharTraits, typename T_Alloc, typename... T_Args>
+	template<typename T_Arg>
+	inline void StaticCmdLine<T_Result, T_Char, T_CharTraits, T_Alloc, T_Args...>::_processArg(const T_Arg& arg, ResultType& result, int& idx_arg, int argc, const CharType* const* argv, StringViewType token) {
+		if constexpr (T_Arg::isSwitch) {
+			arg.set(result);
+		} else {
+			if (++idx_arg >= argc)
+				throw(ArgParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Missing a value for this argument!"), StringType(token)));
+			try {
+				arg.set(result, StringType(argv[idx_arg]));
+			} catch (ArgParseException<T_Char, T_CharTraits, T_Alloc>& e) {
+				throw ArgParseException<T_Char, T_CharTraits, T_Alloc>(e.error(), StringType(token));
+			}
+		}
+	}
+
+	template<typename T_Result, typename T_Char, typename T_CharTraits, typename T_Alloc, typename... T_Args>
+	inline auto StaticCmdLine<T_Result, T_Char, T_CharTraits, T_Alloc, T_Args...>::parse(int argc, const CharType* const* argv) const -> ResultType {
+		const StringViewType strFlagStart(_arrFlagStart.data(), _arrFlagStart.size());
+		const StringViewType strNameStart(_arrNameStart.data(), _arrNameStart.size());
+
+		static constexpr std::array<ProcessType, sizeof...(T_Args)> process = _makeProcessTable(std::index_sequence_for<T_Args...>{});
+
+		ResultType result{};
+		std::array<bool, sizeof...(T_Args)> seen{};
+
+		for (int idx_arg = 1; idx_arg < argc; idx_arg++) {
+			StringViewType token = argv[idx_arg];
+
+			// "--" ends the options.  There are no unlabeled args to take
+			// what follows it, so anything after it is unmatched.
+			if (token == strNameStart) {
+				if (idx_arg + 1 < argc)
+					throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Couldn't find match for argument"), StringType(argv[idx_arg + 1])));
+				break;
+			}
+
+			std::size_t idx = NameTableType::npos;
+			if (token.starts_with(strNameStart))
+				idx = _names.find(token.substr(strNameStart.size()));
+			else if (token.starts_with(strFlagStart) && token.size() > strFlagStart.size()) {
+				StringViewType flags = token.substr(strFlagStart.size());
+				idx = _flags.find(flags.substr(0, 1));
+
+				// several switches combined in one token
+				if (flags.size() > 1) {
+					for (std::size_t i = 0; i < flags.size(); i++) {
+						std::size_t idx_switch = _flags.find(flags.substr(i, 1));
+						if (idx_switch == NameTableType::npos || !_isSwitch[idx_switch])
+							throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Couldn't find match for argument"), StringType(token)));
+						if (seen[idx_switch])
+							throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument already set!"), StringType(token)));
+						seen[idx_switch] = true;
+						process[idx_switch](*this, result, idx_arg, argc, argv, token);
+					}
+					continue;
+				}
+			}
+
+			if (idx == NameTableType::npos)
+				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Couldn't find match for argument"), StringType(token)));
+
+			// multi args may be given more than once
+			if (seen[idx] && !_isMulti[idx])
+				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument already set!"), StringType(token)));
+
+			seen[idx] = true;
+			process[idx](*this, result, idx_arg, argc, argv, token);
+		}
+
+		StringType missing;
+		std::size_t countMissing = 0;
+		for (std::size_t i = 0; i < sizeof...(T_Args); i++) {
+			if (_required[i] && !seen[i]) {
+				if (countMissing++) missing += StringConvertType::fromConstBasicCharString(", ");
+				missing += _names.key(i);
+			}
+		}
+		if (countMissing > 1)
+			throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Required arguments missing: ") + missing));
+		else if (countMissing)
+			throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Required argument missing: ") + missing));
+
+		return result;
+	}
+
+	template<typename T_Result, typename T_Char, typename T_CharTraits, typename T_Alloc, typename... T_Args>
+	inline auto StaticCmdLine<T_Result, T_Char, T_CharTraits, T_Alloc, T_Args...>::parse(int argc, const char* const* argv) const -> ResultType requires (!std::is_same_v<T_Char, char>) {
+		DecodedArgv<T_Char, T_CharTraits, T_Alloc> decoded(argc, argv);
+		return parse(decoded.argc(), decoded.argv());
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//END StaticCmdLine.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
@@ -30,11 +30,16 @@
 #include <list>
 #include <iostream>
 #include <algorithm>
+#include <typeinfo>
+#include <type_traits>
 
 #include <tclap/StringConvert.h>
+#include <tclap/OutputBuffer.h>
 #include <tclap/CmdLineInterface.h>
 #include <tclap/CmdLineOutput.h>
 #include <tclap/XorHandler.h>
+#include <tclap/UsageCache.h>
+#include <tclap/TerminalWidth.h>
 #include <tclap/Arg.h>
 
 namespace TCLAP {
@@ -67,6 +72,8 @@ namespace TCLAP {
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineOutputType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::XorHandlerType;
+		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::OutputBufferType;
+		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::UsageCacheType;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -94,28 +101,138 @@ namespace TCLAP {
 		 */
 		virtual void failure(CmdLineInterfaceType& c, ArgException<T_Char, T_CharTraits, T_Alloc>& e) override;
 
+		/**
+		 * Prints (to stderr) the Args in one section of the help, or the
+		 * sections there are when no Arg is in it.  Only the Args of the
+		 * section are rendered, and the text is written in chunks of
+		 * about sizeChunkSection characters, so that a pager can show
+		 * the first page before the rest is rendered.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param section - The name of the section.
+		 */
+		virtual bool sectionUsage(CmdLineInterfaceType& c, StringViewType section) override;
+
+		/**
+		 * The number of characters after which sectionUsage writes
+		 * what it has rendered.
+		 */
+		static constexpr std::size_t sizeChunkSection = 4096;
+
+		/**
+		 * Renders what usage() prints into out, without writing it.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void renderUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Renders what version() prints into out, without writing it.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void renderVersion(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Renders what failure() prints into out, without writing it or
+		 * exiting.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param e - The ArgException that caused the failure.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void renderFailure(CmdLineInterfaceType& c, const ArgException<T_Char, T_CharTraits, T_Alloc>& e, OutputBufferType& out) const;
+
 	protected:
 		OstreamType* os = nullptr;
 
 		std::unique_ptr<ConvertedStdioStreams<T_Char, T_CharTraits>> convertedStdioStreams;
 
 		/**
-		 * Writes a brief usage message with short args.
+		 * Writes the error message of a failure.
+		 * \param e - The ArgException that caused the failure.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void _errorMessage(const ArgException<T_Char, T_CharTraits, T_Alloc>& e, OutputBufferType& out) const;
+
+		/**
+		 * Writes the brief usage of a failure, which refers to --help.
 		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
 		 */
-		void _shortUsage(CmdLineInterfaceType& c) const;
+		void _briefUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Writes a brief usage message with short args, rendered once
+		 * and then taken from the usage cache of the CmdLine.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void _shortUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
 
 		/**
 		 * Writes a longer usage message with long and short args,
-		 * provides descriptions and prints message.
+		 * provides descriptions and prints message, rendered once and
+		 * then taken from the usage cache of the CmdLine.
 		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
 		 */
-		void _longUsage(CmdLineInterfaceType& c) const;
+		void _longUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Renders the brief usage message of _shortUsage.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void _renderShortUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Renders the longer usage message of _longUsage.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param out - The buffer the text is appended to.
+		 */
+		void _renderLongUsage(CmdLineInterfaceType& c, OutputBufferType& out) const;
+
+		/**
+		 * Appends a part of the usage from the usage cache of the
+		 * CmdLine, rendering and storing it first if it isn't there.
+		 * Outputs of different classes are cached apart.
+		 * \param c - The CmdLine object the output is generated for.
+		 * \param part - The part of the usage.
+		 * \param out - The buffer the text is appended to.
+		 * \param render - Renders the part into the buffer it is given.
+		 */
+		template<typename T_Render>
+		void _cachedUsage(CmdLineInterfaceType& c, typename UsageCacheType::Part part, OutputBufferType& out, T_Render render) const;
+
+		/**
+		 * Returns the width the usage is wrapped to, that of the terminal
+		 * less a margin of 5 columns, so 75 when it isn't a terminal.
+		 */
+		std::size_t _maxWidth() const;
+
+		/**
+		 * Returns the file descriptor that os writes to, for
+		 * TerminalWidth: that of stdout or stderr, or
+		 * TerminalWidth::fdNone for any other stream.
+		 */
+		int _fd() const;
+
+		/**
+		 * Returns the position after at most count code points of s from
+		 * pos.  A surrogate pair of a 16 bit character type is one code
+		 * point, any other character is one of its own, so a char is
+		 * counted as a column of its own.
+		 * \param s - The string.
+		 * \param pos - The position to count from.
+		 * \param count - The number of code points.
+		 */
+		static std::size_t _advanceCodePoints(StringViewType s, std::size_t pos, std::size_t count);
 
 		/**
 		 * This function inserts line breaks and indents long strings
 		 * according to the params input. It will only break lines at spaces,
-		 * commas and pipes.
+		 * commas and pipes.  The text is wrapped in a single pass, and the
+		 * width of a line is counted in code points.
+		 * \param out - The buffer the text is appended to.
 		 * \param s - The string to be printed.
 		 * \param maxWidth - The maxWidth allowed for the output line.
 		 * \param indentSpaces - The number of spaces to indent the first line.
@@ -123,7 +240,8 @@ namespace TCLAP {
 		 * and all subsequent lines in addition to indentSpaces.
 		 */
 		void spacePrint(
-			const StringType& s,
+			OutputBufferType& out,
+			StringViewType s,
 			std::size_t maxWidth,
 			std::size_t indentSpaces,
 			std::size_t secondLineOffset
@@ -143,74 +261,184 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::version(CmdLineInterfaceType& _cmd) {
 		assert(os);
-		*os << _cmd.getVersion() << std::endl;
+		OutputBufferType out(getAlloc());
+		renderVersion(_cmd, out);
+		out.writeTo(*os);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::usage(CmdLineInterfaceType& _cmd) {
 		assert(os);
-		*os << std::endl << StringConvertType::fromConstBasicCharString("USAGE: ") << std::endl << std::endl;
-		_shortUsage(_cmd);
-		*os << std::endl << std::endl << StringConvertType::fromConstBasicCharString("Where: ") << std::endl << std::endl;
-		_longUsage(_cmd);
-		*os << std::endl;
+		OutputBufferType out(getAlloc());
+		renderUsage(_cmd, out);
+		out.writeTo(*os);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::failure(CmdLineInterfaceType& _cmd, ArgException<T_Char, T_CharTraits, T_Alloc>& e) {
 		assert(os);
-		*os
-			<< StringConvertType::fromConstBasicCharString("PARSE ERROR: ") << e.argId() << std::endl
-			<< StringConvertType::fromConstBasicCharString("             ") << e.error() << std::endl << std::endl;
+		OutputBufferType out(getAlloc());
+		_errorMessage(e, out);
 		if (_cmd.hasHelpAndVersion()) {
-			*os << StringConvertType::fromConstBasicCharString("Brief USAGE: ") << std::endl;
-			_shortUsage(_cmd);
-			*os << std::endl << StringConvertType::fromConstBasicCharString("For complete USAGE and HELP type: ")
-				<< std::endl << StringConvertType::fromConstBasicCharString("   ") << _cmd.getProgramName() << StringConvertType::fromConstBasicCharString(" ")
-				<< ArgType::nameStartString() << "help"
-				<< std::endl << std::endl;
-		} else
+			_briefUsage(_cmd, out);
+			out.writeTo(*os);
+		} else {
+			// usage() may be overridden
+			out.writeTo(*os);
 			usage(_cmd);
+		}
 		throw ExitException(1);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
-	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_shortUsage(CmdLineInterfaceType& _cmd) const {
-		ArgListType argList = _cmd.getArgList();
-		StringType progName = _cmd.getProgramName();
-		XorHandlerType xorHandler = _cmd.getXorHandler();
-		ArgVectorVectorType xorList = xorHandler.getXorList();
+	inline bool StdOutput<T_Char, T_CharTraits, T_Alloc>::sectionUsage(CmdLineInterfaceType& _cmd, StringViewType section) {
+		assert(os);
+		const ArgListType& argList = _cmd.getArgList();
+		std::size_t maxWidth = _maxWidth();
+		OutputBufferType out(getAlloc());
+
+		bool found = false;
+		for (const ArgType* const& arg : argList) if (arg->getSection() == section) {
+			if (!found) {
+				out << std::endl << section << StringConvertType::template constBasicString<": ">() << std::endl << std::endl;
+				found = true;
+			}
+			spacePrint(out, arg->longID(), maxWidth, 3, 3);
+			spacePrint(out, arg->getDescription(), maxWidth, 5, 0);
+			out << std::endl;
+			if (out.size() >= sizeChunkSection)
+				out.writeTo(*os);
+		}
+
+		if (!found) {
+			out << StringConvertType::template constBasicString<"No arguments in help section: ">() << section << std::endl;
+			std::vector<StringViewType, typename std::allocator_traits<AllocatorType>::template rebind_alloc<StringViewType>> sections(getAlloc());
+			for (const ArgType* const& arg : argList)
+				if (!arg->getSection().empty() && std::find(sections.begin(), sections.end(), arg->getSection()) == sections.end())
+					sections.push_back(arg->getSection());
+			if (!sections.empty()) {
+				out << StringConvertType::template constBasicString<"Help sections:">();
+				for (StringViewType name : sections)
+					out << StringConvertType::fromConstBasicChar(' ') << name;
+				out << std::endl;
+			}
+		}
+		out.writeTo(*os);
+		return found;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::renderVersion(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		out << _cmd.getVersion() << std::endl;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::renderUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		out << std::endl << StringConvertType::template constBasicString<"USAGE: ">() << std::endl << std::endl;
+		_shortUsage(_cmd, out);
+		out << std::endl << std::endl << StringConvertType::template constBasicString<"Where: ">() << std::endl << std::endl;
+		_longUsage(_cmd, out);
+		out << std::endl;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::renderFailure(CmdLineInterfaceType& _cmd, const ArgException<T_Char, T_CharTraits, T_Alloc>& e, OutputBufferType& out) const {
+		_errorMessage(e, out);
+		if (_cmd.hasHelpAndVersion())
+			_briefUsage(_cmd, out);
+		else
+			renderUsage(_cmd, out);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_errorMessage(const ArgException<T_Char, T_CharTraits, T_Alloc>& e, OutputBufferType& out) const {
+		out
+			<< StringConvertType::template constBasicString<"PARSE ERROR: ">() << e.argId() << std::endl
+			<< StringConvertType::template constBasicString<"             ">() << e.error() << std::endl << std::endl;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_briefUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		out << StringConvertType::template constBasicString<"Brief USAGE: ">() << std::endl;
+		_shortUsage(_cmd, out);
+		out << std::endl << StringConvertType::template constBasicString<"For complete USAGE and HELP type: ">()
+			<< std::endl << StringConvertType::template constBasicString<"   ">() << _cmd.getProgramName() << StringConvertType::fromConstBasicChar(' ')
+			<< ArgType::nameStartString() << StringConvertType::template constBasicString<"help">()
+			<< std::endl << std::endl;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	template<typename T_Render>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_cachedUsage(CmdLineInterfaceType& _cmd, typename UsageCacheType::Part part, OutputBufferType& out, T_Render render) const {
+		UsageCacheType* cache = _cmd.getUsageCache();
+		if (!cache) {
+			render(out);
+			return;
+		}
+
+		const StringType& progName = _cmd.getProgramName();
+		std::size_t width = _maxWidth();
+		const StringType* text = cache->find(typeid(*this), part, progName, width);
+		if (!text) {
+			OutputBufferType rendered(getAlloc());
+			render(rendered);
+			text = &cache->store(typeid(*this), part, progName, width, rendered.release());
+		}
+		out << *text;
+	}
 
-		StringType s = progName + StringConvertType::fromConstBasicCharString(" ");
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_shortUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		_cachedUsage(_cmd, UsageCacheType::Part::ShortUsage, out, [&](OutputBufferType& rendered) { _renderShortUsage(_cmd, rendered); });
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_longUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		_cachedUsage(_cmd, UsageCacheType::Part::LongUsage, out, [&](OutputBufferType& rendered) { _renderLongUsage(_cmd, rendered); });
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_renderShortUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		const ArgListType& argList = _cmd.getArgList();
+		const StringType& progName = _cmd.getProgramName();
+		const XorHandlerType& xorHandler = _cmd.getXorHandler();
+		const ArgVectorVectorType& xorList = xorHandler.getXorList();
+
+		StringType s = progName + StringConvertType::fromConstBasicChar(' ');
 
 		// first the xor
 		for (const ArgVectorType& xorEntry : xorList) {
-			s += StringConvertType::fromConstBasicCharString(" {");
-			for (const ArgType* const& arg : xorEntry)
-				s += arg->shortID() + StringConvertType::fromConstBasicCharString("|");
+			s += StringConvertType::template constBasicString<" {">();
+			for (const ArgType* const& arg : xorEntry) {
+				s += arg->shortID();
+				s += StringConvertType::fromConstBasicChar('|');
+			}
 			s.back() = StringConvertType::fromConstBasicChar('}');
 		}
 
 		// then the rest
 		for (const ArgType* const& arg : argList)
-			if (!xorHandler.contains(arg))
-				s += StringConvertType::fromConstBasicCharString(" ") + arg->shortID();
+			if (!xorHandler.contains(arg)) {
+				s += StringConvertType::fromConstBasicChar(' ');
+				s += arg->shortID();
+			}
 
 		// if the program name is too long, then adjust the second line offset 
+		std::size_t maxWidth = _maxWidth();
 		std::size_t secondLineOffset = progName.size() + 2;
-		if (secondLineOffset > 75 / 2)
-			secondLineOffset = 75 / 2;
+		if (secondLineOffset > maxWidth / 2)
+			secondLineOffset = maxWidth / 2;
 
-		spacePrint(s, 75, 3, secondLineOffset);
+		spacePrint(out, s, maxWidth, 3, secondLineOffset);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
-	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_longUsage(CmdLineInterfaceType& _cmd) const {
-		assert(os);
-		ArgListType argList = _cmd.getArgList();
-		StringType message = _cmd.getMessage();
-		XorHandlerType xorHandler = _cmd.getXorHandler();
-		ArgVectorVectorType xorList = xorHandler.getXorList();
+	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::_renderLongUsage(CmdLineInterfaceType& _cmd, OutputBufferType& out) const {
+		const ArgListType& argList = _cmd.getArgList();
+		const StringType& message = _cmd.getMessage();
+		const XorHandlerType& xorHandler = _cmd.getXorHandler();
+		const ArgVectorVectorType& xorList = xorHandler.getXorList();
+		std::size_t maxWidth = _maxWidth();
 
 		// first the xor 
 		for (const ArgVectorType& xorEntry : xorList) {
@@ -219,86 +447,130 @@ namespace TCLAP {
 				if (is_first_arg)
 					is_first_arg = false;
 				else
-					spacePrint(StringConvertType::fromConstBasicCharString("-- OR --"), 75, 9, 0);
-				spacePrint(arg->longID(), 75, 3, 3);
-				spacePrint(arg->getDescription(), 75, 5, 0);
+					spacePrint(out, StringConvertType::template constBasicString<"-- OR --">(), maxWidth, 9, 0);
+				spacePrint(out, arg->longID(), maxWidth, 3, 3);
+				spacePrint(out, arg->getDescription(), maxWidth, 5, 0);
 			}
-			*os << std::endl << std::endl;
+			out << std::endl << std::endl;
 		}
 
 		// then the rest
 		for (const ArgType* const& arg : argList) if (!xorHandler.contains(arg)) {
-			spacePrint(arg->longID(), 75, 3, 3);
-			spacePrint(arg->getDescription(), 75, 5, 0);
-			*os << std::endl;
+			spacePrint(out, arg->longID(), maxWidth, 3, 3);
+			spacePrint(out, arg->getDescription(), maxWidth, 5, 0);
+			out << std::endl;
 		}
 
-		*os << std::endl;
+		out << std::endl;
+
+		spacePrint(out, message, maxWidth, 3, 0);
+	}
 
-		spacePrint(message, 75, 3, 0);
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t StdOutput<T_Char, T_CharTraits, T_Alloc>::_maxWidth() const {
+		return std::max<std::size_t>(TerminalWidth::get(_fd()), 45) - 5;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline int StdOutput<T_Char, T_CharTraits, T_Alloc>::_fd() const {
+		if (convertedStdioStreams) {
+			if (os == &convertedStdioStreams->getCout())
+				return TerminalWidth::fdStdout;
+			if (os == &convertedStdioStreams->getCerr() || os == &convertedStdioStreams->getClog())
+				return TerminalWidth::fdStderr;
+		}
+		if constexpr (std::is_same_v<OstreamType, std::ostream>) {
+			if (os->rdbuf() == std::cout.rdbuf())
+				return TerminalWidth::fdStdout;
+			if (os->rdbuf() == std::cerr.rdbuf() || os->rdbuf() == std::clog.rdbuf())
+				return TerminalWidth::fdStderr;
+		} else if constexpr (std::is_same_v<OstreamType, std::wostream>) {
+			if (os->rdbuf() == std::wcout.rdbuf())
+				return TerminalWidth::fdStdout;
+			if (os->rdbuf() == std::wcerr.rdbuf() || os->rdbuf() == std::wclog.rdbuf())
+				return TerminalWidth::fdStderr;
+		}
+		return TerminalWidth::fdNone;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t StdOutput<T_Char, T_CharTraits, T_Alloc>::_advanceCodePoints(StringViewType s, std::size_t pos, std::size_t count) {
+		if constexpr (sizeof(CharType) == 2) {
+			using UnitType = std::make_unsigned_t<CharType>;
+			for (; pos < s.size() && count; count--) {
+				UnitType unit = static_cast<UnitType>(s[pos++]);
+				if (unit >= 0xD800 && unit <= 0xDBFF && pos < s.size()) {
+					UnitType low = static_cast<UnitType>(s[pos]);
+					if (low >= 0xDC00 && low <= 0xDFFF) pos++;
+				}
+			}
+			return pos;
+		} else {
+			return count < s.size() - pos ? pos + count : s.size();
+		}
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void StdOutput<T_Char, T_CharTraits, T_Alloc>::spacePrint(
-		const StringType& s,
+		OutputBufferType& out,
+		StringViewType s,
 		std::size_t maxWidth,
 		std::size_t indentSpaces,
 		std::size_t secondLineOffset
 	) const {
-		assert(os);
-		StringViewType strview_remaining = s;
-
-		assert(strview_remaining.size() <= std::numeric_limits<std::size_t>::max() - indentSpaces);
-		if (maxWidth > 0 && strview_remaining.size() + indentSpaces > maxWidth) {
-			bool is_first_line = true;
-			assert(maxWidth > indentSpaces);
-			std::size_t allowedLen = maxWidth - indentSpaces;// allowedLen > 0			
-			while (!strview_remaining.empty()) {
-				// find the substring length
-				std::size_t stringLen = std::min(strview_remaining.size(), allowedLen);// stringLen > 0
-
-				// trim the length so it doesn't end in middle of a word
-				if (stringLen < strview_remaining.size()) {
-					static const std::array arr_wordbreak = StringConvertType::fromConstBasicCharArray(" ,|");
-					StringViewType strview_wordbreak(arr_wordbreak.cbegin(), arr_wordbreak.cend());
-					std::size_t result_find = strview_remaining.substr(0, stringLen).find_last_of(strview_wordbreak);
-					// otherwise, the word is longer than the line, so just split wherever the line ends
-					if (result_find != StringViewType::npos) stringLen = result_find + 1;
-				}
-
-				// check for newlines
-				{
-					std::size_t result_find = strview_remaining.substr(0, stringLen).find_first_of(StringConvertType::fromConstBasicChar('\n'));
-					if (result_find != StringViewType::npos) stringLen = result_find + 1;
-				}
+		constexpr CharType space = StringConvertType::fromConstBasicChar(' ');
+		constexpr CharType newline = StringConvertType::fromConstBasicChar('\n');
+		static const std::array arr_wordbreak = StringConvertType::fromConstBasicCharArray(" ,|");
+		const StringViewType strview_wordbreak(arr_wordbreak.cbegin(), arr_wordbreak.cend());
+
+		assert(maxWidth == 0 || maxWidth > indentSpaces);
+		std::size_t allowedLen = maxWidth ? maxWidth - indentSpaces : s.size();// allowedLen > 0
+		// the first newline at or after start, or s.size(), found once
+		std::size_t next_newline = StringViewType::npos;
+		std::size_t start = 0;
+		bool is_first_line = true;
+		while (is_first_line || start < s.size()) {
+			// the end of the longest line allowed
+			std::size_t end = _advanceCodePoints(s, start, allowedLen);
+
+			// a string that fits is printed as it is, newlines included
+			if (is_first_line && end == s.size()) {
+				out.append(indentSpaces, space);
+				out << s << std::endl;
+				return;
+			}
 
-				// print the indent
-				*os << StringType(indentSpaces, StringConvertType::fromConstBasicChar(' '));
+			// trim the line so it doesn't end in middle of a word
+			if (end < s.size()) {
+				std::size_t result_find = s.substr(start, end - start).find_last_of(strview_wordbreak);
+				// otherwise, the word is longer than the line, so just split wherever the line ends
+				if (result_find != StringViewType::npos) end = start + result_find + 1;
+			}
 
-				if (is_first_line) {
-					assert(allowedLen > secondLineOffset);
-					// handle second line offsets
-					indentSpaces += secondLineOffset;
-					// adjust allowed len
-					allowedLen -= secondLineOffset;// allowedLen > 0
-					is_first_line = false;
-				}
+			// check for newlines
+			if (next_newline == StringViewType::npos || next_newline < start) {
+				next_newline = s.find(newline, start);
+				if (next_newline == StringViewType::npos) next_newline = s.size();
+			}
+			if (next_newline < end) end = next_newline + 1;
+
+			// print the indent
+			out.append(indentSpaces, space);
+
+			if (is_first_line) {
+				assert(allowedLen > secondLineOffset);
+				// handle second line offsets
+				indentSpaces += secondLineOffset;
+				// adjust allowed len
+				allowedLen -= secondLineOffset;// allowedLen > 0
+				is_first_line = false;
+			}
 
-				*os << strview_remaining.substr(0, stringLen) << std::endl;
+			out << s.substr(start, end - start) << std::endl;
 
-				strview_remaining.remove_prefix(stringLen);
-				// so we don't start a line with a space
-				{
-					std::size_t result_find = strview_remaining.find_first_not_of(StringConvertType::fromConstBasicChar(' '));
-					if (result_find == StringViewType::npos) {
-						result_find = strview_remaining.size();
-					}
-					strview_remaining.remove_prefix(result_find);
-				}
-			}
-		} else {
-			*os << StringType(indentSpaces, StringConvertType::fromConstBasicChar(' '));
-			*os << strview_remaining << std::endl;
+			// so we don't start a line with a space
+			start = end;
+			while (start < s.size() && s[start] == space) start++;
 		}
 	}
 
@@ -32,6 +32,7 @@
 
 #include <wchar.h>
 #include <cassert>
+#include <climits>
 #include <cstdlib>
 #include <cuchar>
 #include <limits>
@@ -44,6 +45,9 @@
 #include <streambuf>
 #include <iostream>
 
+#include <tclap/FdWriter.h>
+#include <tclap/Utf8Transcoder.h>
+
 namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits>
 	class StringConvert;
@@ -97,6 +101,26 @@ namespace TCLAP {
 	template<typename T_Char>
 	inline constexpr std::array<T_Char, std::numeric_limits<unsigned char>::max() + 1> mappingFromBasicChar = getMappingFromBasicChar<T_Char>();
 
+	/**
+	 * A string literal of basic characters, to be passed as a template
+	 * argument.
+	 */
+	template<std::size_t size_arr_basic>
+	struct BasicCharLiteral {
+		consteval BasicCharLiteral(const char(&arr_basic_from)[size_arr_basic]) {
+			for (std::size_t i = 0; i < size_arr_basic; ++i) arr_basic[i] = arr_basic_from[i];
+		}
+		char arr_basic[size_arr_basic]{};
+	};
+
+	/**
+	 * The pool of constant strings: the basic characters of str_basic
+	 * converted to T_Char at compile time, with static storage.  A
+	 * character that isn't basic fails to compile.
+	 */
+	template<typename T_Char, typename T_CharTraits, BasicCharLiteral str_basic>
+	inline constexpr auto constBasicCharArray = StringConvert<T_Char, T_CharTraits>::fromConstBasicCharArray(str_basic.arr_basic);
+
 	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
 	class StringConvert {
 	public:
@@ -108,6 +132,12 @@ namespace TCLAP {
 		using StreambufType = std::basic_streambuf<T_Char, T_CharTraits>;
 		using IstreamType = std::basic_istream<T_Char, T_CharTraits>;
 		using OstreamType = std::basic_ostream<T_Char, T_CharTraits>;
+		using MBStreambufType = std::basic_streambuf<char, std::char_traits<char>>;
+		/**
+		 * The lengths of the replacements of invalid characters.
+		 */
+		static constexpr std::size_t sizeInvalidChar = sizeof(CharMapping<T_Char>::arrInvalidChar) / sizeof(typename CharMapping<T_Char>::CharType) - 1;
+		static constexpr std::size_t sizeInvalidMBChar = sizeof(CharMapping<char>::arrInvalidChar) / sizeof(CharMapping<char>::CharType) - 1;
 		StringConvert(const StringConvert& rhs) = delete;
 		StringConvert& operator=(const StringConvert& rhs) = delete;
 		static constexpr CharType fromConstBasicChar(char ch_basic_from) {
@@ -138,134 +168,273 @@ namespace TCLAP {
 			std::array<CharType, size_arr_basic_from - 1> arr_str_to = fromConstBasicCharArray(arr_basic_from);
 			return StringTypeTmpl<T_Alloc>(arr_str_to.data(), arr_str_to.size(), alloc);
 		}
+		/**
+		 * A view of a string of basic characters from the pool of constant
+		 * strings, which doesn't allocate, unlike fromConstBasicCharString.
+		 */
+		template<BasicCharLiteral str_basic>
+		static constexpr StringViewType constBasicString() {
+			return StringViewType(constBasicCharArray<CharType, CharTraitsType, str_basic>.data(), constBasicCharArray<CharType, CharTraitsType, str_basic>.size());
+		}
 		static std::size_t toMBCharRestartable(char(&mbch)[MB_LEN_MAX], const CharType& ch, std::mbstate_t& mbstate);
 		static std::size_t fromMBCharRestartable(CharType& ch, const char* p_mbs, std::size_t size_mbs, std::mbstate_t& mbstate);
-		template<typename T_Alloc = std::allocator<char>>
-		static std::basic_string<char, std::char_traits<char>, T_Alloc> toMBStringRestartable(const StringViewType& strview, std::mbstate_t& mbstate) {
-			std::basic_string<char, std::char_traits<char>, T_Alloc> str;
+		/**
+		 * An upper bound of the number of bytes toMBString makes of size
+		 * characters, which is what the overloads writing to a buffer need
+		 * room for.
+		 */
+		static std::size_t maxMBSize(std::size_t size) {
+			std::size_t size_per_char = std::max<std::size_t>(MB_CUR_MAX, sizeInvalidMBChar);
+			if constexpr (Utf8Transcoder<T_Char>::enabled)
+				size_per_char = std::max(size_per_char, Utf8Transcoder<T_Char>::maxBytesPerChar);
+			// And the sequence returning to the initial shift state.
+			return size * size_per_char + MB_LEN_MAX;
+		}
+		/**
+		 * An upper bound of the number of characters fromMBString makes of
+		 * size_mbs bytes, which is what the overloads writing to a buffer
+		 * need room for: every byte ends at most one character, or is
+		 * replaced.  In UTF-16 a character outside the BMP takes two
+		 * units, and when its first bytes came in an earlier call both are
+		 * written for the bytes that finish it, hence one more unit.
+		 */
+		static constexpr std::size_t maxFromMBSize(std::size_t size_mbs) {
+			return size_mbs * std::max<std::size_t>(1, sizeInvalidChar) + (sizeof(T_Char) == 2 ? 1 : 0);
+		}
+		/**
+		 * Converts to the multibyte encoding, writing to p_out, which must
+		 * have room for maxMBSize(strview.size()) bytes.  Returns the number
+		 * of bytes written.
+		 */
+		static std::size_t toMBStringRestartable(const StringViewType& strview, std::mbstate_t& mbstate, char* p_out) {
+			const CharType* p_chs = strview.data();
+			std::size_t size_chs = strview.size();
+			std::size_t size_out = 0;
+			if constexpr (Utf8Transcoder<T_Char>::enabled) {
+				if (std::mbsinit(&mbstate) && Utf8Transcoder<T_Char>::isUtf8Locale()) {
+					std::size_t size_read = Utf8Transcoder<T_Char>::encode(p_chs, size_chs, p_out, size_out);
+					p_chs += size_read;
+					size_chs -= size_read;
+				}
+			}
 			char mbch[MB_LEN_MAX]{};
-			std::size_t result_mbconv = 0;
-			for (const CharType& ch : strview) {
-				result_mbconv = toMBCharRestartable(mbch, ch, mbstate);
+			for (std::size_t i = 0; i < size_chs; ++i) {
+				std::size_t result_mbconv = toMBCharRestartable(mbch, p_chs[i], mbstate);
 				if (result_mbconv == static_cast<std::size_t>(-1)) {
 					mbstate = mbstate_t{};
-					str.append(
-						CharMapping<char>::arrInvalidChar,
-						CharMapping<char>::arrInvalidChar + (sizeof(CharMapping<char>::arrInvalidChar) / sizeof(CharMapping<char>::CharType) - 1)
-					);
+					std::char_traits<char>::copy(p_out + size_out, CharMapping<char>::arrInvalidChar, sizeInvalidMBChar);
+					size_out += sizeInvalidMBChar;
 				} else {
 					assert(result_mbconv <= MB_LEN_MAX);
-					str.append(mbch, result_mbconv);
+					std::char_traits<char>::copy(p_out + size_out, mbch, result_mbconv);
+					size_out += result_mbconv;
 				}
 			}
-			return str;
+			return size_out;
 		}
-		template<typename T_Alloc = std::allocator<T_Char>>
-		static StringTypeTmpl<T_Alloc> fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, std::mbstate_t& mbstate) {
-			std::basic_string_view<char, std::char_traits<char>> strview_temp = strview;
-			StringTypeTmpl<T_Alloc> str;
+		/**
+		 * Converts from the multibyte encoding, writing to p_out, which must
+		 * have room for maxFromMBSize(strview.size()) characters.  Returns
+		 * the number of characters written.
+		 */
+		static std::size_t fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, std::mbstate_t& mbstate, CharType* p_out) {
+			const char* p_mbs = strview.data();
+			std::size_t size_mbs = strview.size();
+			std::size_t size_out = 0;
+			if constexpr (Utf8Transcoder<T_Char>::enabled) {
+				if (std::mbsinit(&mbstate) && Utf8Transcoder<T_Char>::isUtf8Locale()) {
+					std::size_t size_read = Utf8Transcoder<T_Char>::decode(p_mbs, size_mbs, p_out, size_out);
+					p_mbs += size_read;
+					size_mbs -= size_read;
+				}
+			}
 			CharType ch{};
-			std::size_t result_mbconv = 0;
-			for (; !strview_temp.empty(); strview_temp.remove_prefix(result_mbconv)) {
-				result_mbconv = fromMBCharRestartable(ch, strview_temp.data(), strview_temp.size(), mbstate);
-				if (result_mbconv <= strview_temp.size()) {
+			while (size_mbs) {
+				std::size_t result_mbconv = fromMBCharRestartable(ch, p_mbs, size_mbs, mbstate);
+				if (result_mbconv <= size_mbs) {
 					if (!result_mbconv) result_mbconv = 1;
 					// Written one, read some.
-					str.push_back(ch);
+					p_out[size_out++] = ch;
 				} else {
 					switch (result_mbconv) {
-						case -1:
+						case static_cast<std::size_t>(-1):
 							mbstate = mbstate_t{};
-							str.append(
-								CharMapping<T_Char>::arrInvalidChar,
-								CharMapping<T_Char>::arrInvalidChar + (sizeof(CharMapping<T_Char>::arrInvalidChar) / sizeof(CharMapping<T_Char>::CharType) - 1)
-							);
+							CharTraitsType::copy(p_out + size_out, CharMapping<T_Char>::arrInvalidChar, sizeInvalidChar);
+							size_out += sizeInvalidChar;
 							result_mbconv = 1;
 							break;
-						case -2:
+						case static_cast<std::size_t>(-2):
 							// Written none, read all.
-							result_mbconv = strview_temp.size();
+							result_mbconv = size_mbs;
 							break;
-						case -3:
+						case static_cast<std::size_t>(-3):
 							// Written one, read none.
-							str.push_back(ch);
+							p_out[size_out++] = ch;
 							result_mbconv = 0;
 							break;
 						default:
 							assert(false);abort();
 					}
 				}
-				assert(result_mbconv >= 0 && result_mbconv <= strview_temp.size());
+				assert(result_mbconv <= size_mbs);
+				p_mbs += result_mbconv;
+				size_mbs -= result_mbconv;
 			}
-			return str;
+			if constexpr (sizeof(CharType) == 2) {
+				// The low surrogate of the last character is only returned by
+				// another call, which reads nothing; get it now rather than
+				// leave it in mbstate, where the next call may never ask for
+				// it.
+				if (size_out && p_out[size_out - 1] >= 0xD800 && p_out[size_out - 1] <= 0xDBFF) {
+					const char mbch_null{};
+					if (fromMBCharRestartable(ch, &mbch_null, 1, mbstate) == static_cast<std::size_t>(-3))
+						p_out[size_out++] = ch;
+				}
+			}
+			return size_out;
 		}
-		template<typename T_Alloc = std::allocator<char>>
-		static std::basic_string<char, std::char_traits<char>, T_Alloc> toMBString(const StringViewType& strview) {
+		/**
+		 * Converts to the multibyte encoding and returns to the initial
+		 * shift state, writing to p_out, which must have room for
+		 * maxMBSize(strview.size()) bytes.  Returns the number of bytes
+		 * written.
+		 */
+		static std::size_t toMBString(const StringViewType& strview, char* p_out) {
 			std::mbstate_t mbstate{};
-			std::basic_string<char, std::char_traits<char>, T_Alloc> str = toMBStringRestartable(strview, mbstate);
-			{
-				char mbch[MB_LEN_MAX]{};
-				std::size_t result_mbconv = toMBCharRestartable(mbch, CharType{}, mbstate);
-				if (result_mbconv == static_cast<std::size_t>(-1)) {
-					mbstate = mbstate_t{};
-					str.append(
-						CharMapping<char>::arrInvalidChar,
-						CharMapping<char>::arrInvalidChar + (sizeof(CharMapping<char>::arrInvalidChar) / sizeof(CharMapping<char>::CharType) - 1)
-					);
-				} else {
-					assert(result_mbconv <= MB_LEN_MAX);
-					assert(result_mbconv > 0);
-					assert(CharTraitsType::eq(mbch[result_mbconv - 1], char{}));
-					str.append(mbch, result_mbconv - 1);
-				}
+			std::size_t size_out = toMBStringRestartable(strview, mbstate, p_out);
+			char mbch[MB_LEN_MAX]{};
+			std::size_t result_mbconv = toMBCharRestartable(mbch, CharType{}, mbstate);
+			if (result_mbconv == static_cast<std::size_t>(-1)) {
+				mbstate = mbstate_t{};
+				std::char_traits<char>::copy(p_out + size_out, CharMapping<char>::arrInvalidChar, sizeInvalidMBChar);
+				size_out += sizeInvalidMBChar;
+			} else {
+				assert(result_mbconv <= MB_LEN_MAX);
+				assert(result_mbconv > 0);
+				assert(CharTraitsType::eq(mbch[result_mbconv - 1], char{}));
+				std::char_traits<char>::copy(p_out + size_out, mbch, result_mbconv - 1);
+				size_out += result_mbconv - 1;
 			}
-			return str;
+			return size_out;
 		}
-		template<typename T_Alloc = std::allocator<T_Char>>
-		static StringTypeTmpl<T_Alloc> fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview) {
+		/**
+		 * Converts from the multibyte encoding, completing or replacing an
+		 * incomplete character at the end, and writing to p_out, which must
+		 * have room for maxFromMBSize(strview.size()) characters.  Returns
+		 * the number of characters written.
+		 */
+		static std::size_t fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview, CharType* p_out) {
 			std::mbstate_t mbstate{};
-			StringTypeTmpl<T_Alloc> str = fromMBStringRestartable(strview, mbstate);
-			{
-				CharType ch{};
-				const char mbch_null{};
-				while (true) {
-					std::size_t result_mbconv = fromMBCharRestartable(ch, &mbch_null, 1, mbstate);
-					bool is_pending_append_ch = false;
-					if (result_mbconv <= 1) {
-						is_pending_append_ch = true;
-					} else {
-						switch (result_mbconv) {
-							case -1:
-								mbstate = mbstate_t{};
-								str.append(
-									CharMapping<T_Char>::arrInvalidChar,
-									CharMapping<T_Char>::arrInvalidChar + (sizeof(CharMapping<T_Char>::arrInvalidChar) / sizeof(CharMapping<T_Char>::CharType) - 1)
-								);
-								ch = CharType{};
-								is_pending_append_ch = true;
-								break;
-							case -2:
-								// Written none, read all.
-								is_pending_append_ch = false;
-								break;
-							case -3:
-								// Written one, read none.
-								is_pending_append_ch = true;
-								break;
-							default:
-								assert(false);abort();
-						}
-					}
-					if (is_pending_append_ch) {
-						if (CharTraitsType::eq(ch, CharType{})) {
+			std::size_t size_out = fromMBStringRestartable(strview, mbstate, p_out);
+			CharType ch{};
+			const char mbch_null{};
+			while (true) {
+				std::size_t result_mbconv = fromMBCharRestartable(ch, &mbch_null, 1, mbstate);
+				bool is_pending_append_ch = false;
+				if (result_mbconv <= 1) {
+					is_pending_append_ch = true;
+				} else {
+					switch (result_mbconv) {
+						case static_cast<std::size_t>(-1):
+							mbstate = mbstate_t{};
+							CharTraitsType::copy(p_out + size_out, CharMapping<T_Char>::arrInvalidChar, sizeInvalidChar);
+							size_out += sizeInvalidChar;
+							ch = CharType{};
+							is_pending_append_ch = true;
 							break;
-						}
-						str.push_back(ch);
+						case static_cast<std::size_t>(-2):
+							// Written none, read all.
+							is_pending_append_ch = false;
+							break;
+						case static_cast<std::size_t>(-3):
+							// Written one, read none.
+							is_pending_append_ch = true;
+							break;
+						default:
+							assert(false);abort();
+					}
+				}
+				if (is_pending_append_ch) {
+					if (CharTraitsType::eq(ch, CharType{})) {
+						break;
 					}
+					p_out[size_out++] = ch;
 				}
 			}
+			return size_out;
+		}
+		/**
+		 * Appends the conversion to the multibyte encoding to str, growing
+		 * it at most once.
+		 */
+		template<typename T_Alloc>
+		static void toMBStringRestartable(const StringViewType& strview, std::mbstate_t& mbstate, std::basic_string<char, std::char_traits<char>, T_Alloc>& str) {
+			std::size_t size_old = str.size();
+			str.resize(size_old + maxMBSize(strview.size()));
+			str.resize(size_old + toMBStringRestartable(strview, mbstate, str.data() + size_old));
+		}
+		/**
+		 * Appends the conversion from the multibyte encoding to str,
+		 * growing it at most once.
+		 */
+		template<typename T_Alloc>
+		static void fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, std::mbstate_t& mbstate, StringTypeTmpl<T_Alloc>& str) {
+			std::size_t size_old = str.size();
+			str.resize(size_old + maxFromMBSize(strview.size()));
+			str.resize(size_old + fromMBStringRestartable(strview, mbstate, str.data() + size_old));
+		}
+		/**
+		 * Appends the conversion to the multibyte encoding to str, growing
+		 * it at most once.  To convert many strings with one allocation,
+		 * reserve the sum of their maxMBSize first.
+		 */
+		template<typename T_Alloc>
+		static void toMBString(const StringViewType& strview, std::basic_string<char, std::char_traits<char>, T_Alloc>& str) {
+			std::size_t size_old = str.size();
+			str.resize(size_old + maxMBSize(strview.size()));
+			str.resize(size_old + toMBString(strview, str.data() + size_old));
+		}
+		/**
+		 * Appends the conversion from the multibyte encoding to str, growing
+		 * it at most once.  To convert many strings, such as the whole argv,
+		 * with one allocation, reserve the sum of their maxFromMBSize first.
+		 */
+		template<typename T_Alloc>
+		static void fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview, StringTypeTmpl<T_Alloc>& str) {
+			std::size_t size_old = str.size();
+			str.resize(size_old + maxFromMBSize(strview.size()));
+			str.resize(size_old + fromMBString(strview, str.data() + size_old));
+		}
+		template<typename T_Alloc = std::allocator<char>>
+		static std::basic_string<char, std::char_traits<char>, T_Alloc> toMBStringRestartable(const StringViewType& strview, std::mbstate_t& mbstate) {
+			std::basic_string<char, std::char_traits<char>, T_Alloc> str;
+			toMBStringRestartable(strview, mbstate, str);
+			return str;
+		}
+		template<typename T_Alloc = std::allocator<T_Char>>
+		static StringTypeTmpl<T_Alloc> fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, std::mbstate_t& mbstate) {
+			StringTypeTmpl<T_Alloc> str;
+			fromMBStringRestartable(strview, mbstate, str);
+			return str;
+		}
+		template<typename T_Alloc = std::allocator<char>>
+		static std::basic_string<char, std::char_traits<char>, T_Alloc> toMBString(const StringViewType& strview) {
+			std::basic_string<char, std::char_traits<char>, T_Alloc> str;
+			toMBString(strview, str);
+			return str;
+		}
+		template<typename T_Alloc = std::allocator<T_Char>>
+		static StringTypeTmpl<T_Alloc> fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview) {
+			StringTypeTmpl<T_Alloc> str;
+			fromMBString(strview, str);
 			return str;
 		}
+		/**
+		 * Reads characters converted from a multibyte stream buffer.  The
+		 * bytes are read into a fixed buffer and converted into another,
+		 * both allocated on construction, and large reads are converted
+		 * directly into the destination.
+		 */
 		class ConvertedIstreamBuf final : public StreambufType {
 		public:
 			using char_type = T_Char;
@@ -273,10 +442,20 @@ namespace TCLAP {
 			using int_type = typename T_CharTraits::int_type;
 			using pos_type = typename T_CharTraits::pos_type;
 			using off_type = typename T_CharTraits::off_type;
-			explicit ConvertedIstreamBuf(StreambufType* streambuf_wrapped)
+			/**
+			 * The number of bytes read from the wrapped stream buffer at a
+			 * time by default.
+			 */
+			static constexpr std::size_t defaultBufferSize = 0x1000;
+			/**
+			 * \param streambuf_wrapped - The multibyte stream buffer to read.
+			 * \param size_buffer - The most bytes read from it at a time.
+			 */
+			explicit ConvertedIstreamBuf(MBStreambufType* streambuf_wrapped, std::size_t size_buffer = defaultBufferSize)
 				: StreambufType(),
 				_streambuf_wrapped(streambuf_wrapped),
-				_vecbuf_buffer(_size_buffer, char_type{}) {
+				_vecbuf_unconv(std::max<std::size_t>(size_buffer, 1)),
+				_vecbuf_buffer(_size_putback + maxFromMBSize(_vecbuf_unconv.size()), char_type{}) {
 				assert(_streambuf_wrapped);
 				StreambufType::setg(nullptr, nullptr, nullptr);
 			}
@@ -284,23 +463,18 @@ namespace TCLAP {
 				: StreambufType(static_cast<const StreambufType&>(rhs)),
 				_streambuf_wrapped(rhs._streambuf_wrapped),
 				_mbstate(rhs._mbstate),
+				_vecbuf_unconv(rhs._vecbuf_unconv),
 				_vecbuf_buffer(rhs._vecbuf_buffer) {
-				StreambufType::setg(
-					StreambufType::eback() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::gptr() ? _vecbuf_buffer.data() + (StreambufType::gptr() - StreambufType::eback()) : nullptr,
-					StreambufType::egptr() ? _vecbuf_buffer.data() + (StreambufType::egptr() - StreambufType::eback()) : nullptr
-				);
+				_rebaseGetArea(rhs);
 			}
 			ConvertedIstreamBuf(ConvertedIstreamBuf&& rhs)
 				: StreambufType(std::move(static_cast<StreambufType&>(rhs))),
 				_streambuf_wrapped(std::move(rhs._streambuf_wrapped)),
 				_mbstate(std::move(rhs._mbstate)),
+				_vecbuf_unconv(std::move(rhs._vecbuf_unconv)),
 				_vecbuf_buffer(std::move(rhs._vecbuf_buffer)) {
-				StreambufType::setg(
-					StreambufType::eback() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::gptr() ? _vecbuf_buffer.data() + (StreambufType::gptr() - StreambufType::eback()) : nullptr,
-					StreambufType::egptr() ? _vecbuf_buffer.data() + (StreambufType::egptr() - StreambufType::eback()) : nullptr
-				);
+				_rebaseGetArea(*this);
+				rhs.StreambufType::setg(nullptr, nullptr, nullptr);
 			}
 			virtual ~ConvertedIstreamBuf() override {
 				if (_streambuf_wrapped) StreambufType::pubsync();
@@ -309,81 +483,82 @@ namespace TCLAP {
 				static_cast<StreambufType&>(*this) = static_cast<const StreambufType&>(rhs);
 				_streambuf_wrapped = rhs._streambuf_wrapped;
 				_mbstate = rhs._mbstate;
+				_vecbuf_unconv = rhs._vecbuf_unconv;
 				_vecbuf_buffer = rhs._vecbuf_buffer;
-				StreambufType::setg(
-					StreambufType::eback() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::gptr() ? _vecbuf_buffer.data() + (StreambufType::gptr() - StreambufType::eback()) : nullptr,
-					StreambufType::egptr() ? _vecbuf_buffer.data() + (StreambufType::egptr() - StreambufType::eback()) : nullptr
-				);
+				_rebaseGetArea(rhs);
 				return *this;
 			}
 			ConvertedIstreamBuf& operator=(ConvertedIstreamBuf&& rhs) {
 				static_cast<StreambufType&>(*this) = std::move(static_cast<StreambufType&>(rhs));
 				_streambuf_wrapped = std::move(rhs._streambuf_wrapped);
 				_mbstate = std::move(rhs._mbstate);
+				_vecbuf_unconv = std::move(rhs._vecbuf_unconv);
 				_vecbuf_buffer = std::move(rhs._vecbuf_buffer);
-				StreambufType::setg(
-					StreambufType::eback() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::gptr() ? _vecbuf_buffer.data() + (StreambufType::gptr() - StreambufType::eback()) : nullptr,
-					StreambufType::egptr() ? _vecbuf_buffer.data() + (StreambufType::egptr() - StreambufType::eback()) : nullptr
-				);
+				_rebaseGetArea(*this);
+				rhs.StreambufType::setg(nullptr, nullptr, nullptr);
 				return *this;
 			}
 		protected:
-			StreambufType* _streambuf_wrapped = nullptr;
+			MBStreambufType* _streambuf_wrapped = nullptr;
 			mbstate_t _mbstate{};
+			/**
+			 * The bytes read, before conversion.
+			 */
+			std::vector<char> _vecbuf_unconv;
+			/**
+			 * The putback area, followed by the converted characters, with
+			 * room for maxFromMBSize of a full _vecbuf_unconv, which _fill
+			 * may write in one go.
+			 */
 			std::vector<char_type> _vecbuf_buffer;
 			virtual int_type underflow() override {
 				assert(_streambuf_wrapped);
-				{
-					std::vector<char> vecbuf_unconv;
-					std::streamsize count_mbchar_get = std::clamp<std::streamsize>(_streambuf_wrapped->showmanyc(), 1, _count_mbchar_get_max);
-					assert(count_mbchar_get > 0);
-					vecbuf_unconv.resize(count_mbchar_get);
-					count_mbchar_get = std::max<std::streamsize>(_streambuf_wrapped->sgetn(vecbuf_unconv.data(), count_mbchar_get), 0);
-					assert(count_mbchar_get > 0);
-					vecbuf_unconv.resize(count_mbchar_get);
-					if (!vecbuf_unconv.empty()) {
-						if (StreambufType::gptr() != StreambufType::eback()) {
-							assert(StreambufType::eback());
-							assert(StreambufType::gptr());
-							_vecbuf_buffer.erase(_vecbuf_buffer.cbegin(), _vecbuf_buffer.cbegin() + (StreambufType::egptr() - StreambufType::eback()));
-						}
-						{
-							StringTypeTmpl<std::allocator<char_type>> str = fromMBStringRestartable<std::allocator<char_type>>(std::basic_string_view<char, std::char_traits<char>>(vecbuf_unconv.data(), vecbuf_unconv.size()), _mbstate);
-							_vecbuf_buffer.insert(_vecbuf_buffer.cend(), str.begin(), str.end());
-						}
-					}
-				}
-				if (!_vecbuf_buffer.empty()) {
-					StreambufType::setg(_vecbuf_buffer.data(), _vecbuf_buffer.data() + (StreambufType::gptr() - StreambufType::eback()), _vecbuf_buffer.data() + _vecbuf_buffer.size());
+				if (StreambufType::gptr() != StreambufType::egptr())
 					return traits_type::to_int_type(*StreambufType::gptr());
-				} else {
-					StreambufType::setg(nullptr, nullptr, nullptr);
-					return traits_type::eof();
-				}
-			}
-			virtual int_type uflow() override {
-				int_type int_ch = underflow();
-				if (!traits_type::eq_int_type(int_ch, traits_type::eof())) {
-					assert(StreambufType::gptr() && StreambufType::gptr() != StreambufType::egptr());
-					StreambufType::gbump(1);
+				// Keep the last characters read for putback.
+				std::size_t size_putback = 0;
+				if (StreambufType::gptr()) {
+					size_putback = std::min<std::size_t>(StreambufType::gptr() - StreambufType::eback(), _size_putback);
+					traits_type::move(_vecbuf_buffer.data() + _size_putback - size_putback, StreambufType::gptr() - size_putback, size_putback);
 				}
-				return int_ch;
+				char_type* p_begin = _vecbuf_buffer.data() + _size_putback;
+				std::size_t size_conv = _fill(p_begin, false);
+				StreambufType::setg(p_begin - size_putback, p_begin, p_begin + size_conv);
+				return size_conv ? traits_type::to_int_type(*p_begin) : traits_type::eof();
 			}
 			virtual std::streamsize xsgetn(char_type* ptr, std::streamsize size_get) override {
 				char_type* ptr_temp = ptr;
 				std::streamsize size_get_remaining = size_get;
+				bool is_bulk = false;
 				while (size_get_remaining > 0) {
-					if (traits_type::eq_int_type(underflow(), traits_type::eof())) break;
-					assert(StreambufType::gptr() && StreambufType::gptr() != StreambufType::egptr());
 					std::streamsize size_copy = std::min(size_get_remaining, StreambufType::egptr() - StreambufType::gptr());
-					assert(size_copy > 0);
-					assert(ptr);
-					std::copy(StreambufType::gptr(), StreambufType::gptr() + size_copy, ptr_temp);
-					StreambufType::setg(StreambufType::eback(), StreambufType::gptr() + size_copy, StreambufType::egptr());
-					ptr_temp += size_copy;
-					size_get_remaining -= size_copy;
+					if (size_copy > 0) {
+						assert(ptr);
+						traits_type::copy(ptr_temp, StreambufType::gptr(), static_cast<std::size_t>(size_copy));
+						StreambufType::gbump(static_cast<int>(size_copy));
+						ptr_temp += size_copy;
+						size_get_remaining -= size_copy;
+						continue;
+					}
+					if (static_cast<std::size_t>(size_get_remaining) >= maxFromMBSize(_vecbuf_unconv.size())) {
+						// Convert straight into the destination.
+						std::size_t size_conv = _fill(ptr_temp, true);
+						if (!size_conv) break;
+						is_bulk = true;
+						ptr_temp += size_conv;
+						size_get_remaining -= static_cast<std::streamsize>(size_conv);
+					} else {
+						is_bulk = false;
+						if (traits_type::eq_int_type(underflow(), traits_type::eof())) break;
+					}
+				}
+				if (is_bulk) {
+					// The get area still holds what came before the bulk read,
+					// so keep the last characters read for putback instead.
+					std::size_t size_putback = std::min<std::size_t>(ptr_temp - ptr, _size_putback);
+					char_type* p_begin = _vecbuf_buffer.data() + _size_putback;
+					traits_type::copy(p_begin - size_putback, ptr_temp - size_putback, size_putback);
+					StreambufType::setg(p_begin - size_putback, p_begin, p_begin);
 				}
 				assert(size_get_remaining >= 0);
 				return size_get - size_get_remaining;
@@ -394,9 +569,46 @@ namespace TCLAP {
 				return 0;
 			}
 		private:
-			static constexpr std::size_t _size_buffer = 0x100;
-			static constexpr std::streamsize _count_mbchar_get_max = 0x100;
+			/**
+			 * The number of characters kept for putback.
+			 */
+			static constexpr std::size_t _size_putback = 4;
+			/**
+			 * Reads bytes until some characters are converted into p_out, or
+			 * the wrapped stream buffer runs out, and returns the number of
+			 * characters.  Only reads what is available without blocking,
+			 * but at least a byte, unless is_bulk is set.
+			 */
+			std::size_t _fill(char_type* p_out, bool is_bulk) {
+				std::size_t size_conv = 0;
+				while (!size_conv) {
+					std::streamsize count_mbchar_get = static_cast<std::streamsize>(_vecbuf_unconv.size());
+					if (!is_bulk)
+						count_mbchar_get = std::clamp<std::streamsize>(_streambuf_wrapped->in_avail(), 1, count_mbchar_get);
+					count_mbchar_get = _streambuf_wrapped->sgetn(_vecbuf_unconv.data(), count_mbchar_get);
+					if (count_mbchar_get <= 0) break;
+					size_conv = fromMBStringRestartable(std::basic_string_view<char, std::char_traits<char>>(_vecbuf_unconv.data(), static_cast<std::size_t>(count_mbchar_get)), _mbstate, p_out);
+				}
+				return size_conv;
+			}
+			/**
+			 * Points the get area, copied or moved from rhs, into the buffer.
+			 */
+			void _rebaseGetArea(const ConvertedIstreamBuf& rhs) {
+				if (!StreambufType::eback()) return;
+				std::ptrdiff_t offset_begin = StreambufType::eback() - rhs._vecbuf_buffer.data();
+				std::ptrdiff_t offset_next = StreambufType::gptr() - StreambufType::eback();
+				std::ptrdiff_t offset_end = StreambufType::egptr() - StreambufType::eback();
+				StreambufType::setg(_vecbuf_buffer.data() + offset_begin, _vecbuf_buffer.data() + offset_begin + offset_next, _vecbuf_buffer.data() + offset_begin + offset_end);
+			}
 		};
+		/**
+		 * Writes characters converted to a multibyte stream buffer, or to a
+		 * file descriptor.  The characters are buffered, and a flush
+		 * converts them into a byte buffer that grows to the largest flush
+		 * and writes the bytes at once.  A write that doesn't fit in the
+		 * buffer is converted along with what is buffered, without copying.
+		 */
 		class ConvertedOstreamBuf final : public StreambufType {
 		public:
 			using char_type = T_Char;
@@ -404,113 +616,157 @@ namespace TCLAP {
 			using int_type = typename T_CharTraits::int_type;
 			using pos_type = typename T_CharTraits::pos_type;
 			using off_type = typename T_CharTraits::off_type;
-			explicit ConvertedOstreamBuf(StreambufType* streambuf_wrapped)
+			/**
+			 * The number of characters buffered by default.
+			 */
+			static constexpr std::size_t defaultBufferSize = 0x1000;
+			/**
+			 * \param streambuf_wrapped - The multibyte stream buffer to write.
+			 * \param size_buffer - The number of characters buffered.
+			 */
+			explicit ConvertedOstreamBuf(MBStreambufType* streambuf_wrapped, std::size_t size_buffer = defaultBufferSize)
 				: StreambufType(),
 				_streambuf_wrapped(streambuf_wrapped),
-				_vecbuf_buffer(_size_buffer, char_type{}) {
+				_vecbuf_buffer(std::max<std::size_t>(size_buffer, 1), char_type{}),
+				_vecbuf_conv(maxMBSize(_vecbuf_buffer.size())) {
 				assert(_streambuf_wrapped);
-				StreambufType::setp(_vecbuf_buffer.data(), _vecbuf_buffer.data(), _vecbuf_buffer.data() + _vecbuf_buffer.size());
+				StreambufType::setp(_vecbuf_buffer.data(), _vecbuf_buffer.data() + _vecbuf_buffer.size());
+			}
+			/**
+			 * Writes to a file descriptor instead, with a single write(2)
+			 * for each flush unless it is interrupted.  Data buffered by the
+			 * stdio streams for the same file isn't flushed first.
+			 * \param fd - The file descriptor to write.
+			 * \param size_buffer - The number of characters buffered.
+			 */
+			explicit ConvertedOstreamBuf(int fd, std::size_t size_buffer = defaultBufferSize)
+				: StreambufType(),
+				_fd(fd),
+				_vecbuf_buffer(std::max<std::size_t>(size_buffer, 1), char_type{}),
+				_vecbuf_conv(maxMBSize(_vecbuf_buffer.size())) {
+				assert(_fd >= 0);
+				StreambufType::setp(_vecbuf_buffer.data(), _vecbuf_buffer.data() + _vecbuf_buffer.size());
 			}
 			ConvertedOstreamBuf(const ConvertedOstreamBuf& rhs)
 				: StreambufType(static_cast<const StreambufType&>(rhs)),
 				_streambuf_wrapped(rhs._streambuf_wrapped),
+				_fd(rhs._fd),
 				_mbstate(rhs._mbstate),
-				_vecbuf_buffer(rhs._vecbuf_buffer) {
-				StreambufType::setp(
-					StreambufType::pbase() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::pptr() ? _vecbuf_buffer.data() + (StreambufType::pptr() - StreambufType::pbase()) : nullptr,
-					StreambufType::epptr() ? _vecbuf_buffer.data() + (StreambufType::epptr() - StreambufType::pbase()) : nullptr
-				);
+				_vecbuf_buffer(rhs._vecbuf_buffer),
+				_vecbuf_conv(rhs._vecbuf_conv.size()) {
+				_rebasePutArea(rhs);
 			}
 			ConvertedOstreamBuf(ConvertedOstreamBuf&& rhs)
 				: StreambufType(std::move(static_cast<StreambufType&>(rhs))),
 				_streambuf_wrapped(std::move(rhs._streambuf_wrapped)),
+				_fd(rhs._fd),
 				_mbstate(std::move(rhs._mbstate)),
-				_vecbuf_buffer(std::move(rhs._vecbuf_buffer)) {
-				StreambufType::setp(
-					StreambufType::pbase() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::pptr() ? _vecbuf_buffer.data() + (StreambufType::pptr() - StreambufType::pbase()) : nullptr,
-					StreambufType::epptr() ? _vecbuf_buffer.data() + (StreambufType::epptr() - StreambufType::pbase()) : nullptr
-				);
+				_vecbuf_buffer(std::move(rhs._vecbuf_buffer)),
+				_vecbuf_conv(std::move(rhs._vecbuf_conv)) {
+				_rebasePutArea(*this);
+				rhs._streambuf_wrapped = nullptr;
+				rhs._fd = -1;
+				rhs.StreambufType::setp(nullptr, nullptr);
 			}
 			virtual ~ConvertedOstreamBuf() override {
-				if (_streambuf_wrapped) StreambufType::pubsync();
+				if (_streambuf_wrapped || _fd >= 0) StreambufType::pubsync();
 			}
 			ConvertedOstreamBuf& operator=(const ConvertedOstreamBuf& rhs) {
 				static_cast<StreambufType&>(*this) = static_cast<const StreambufType&>(rhs);
 				_streambuf_wrapped = rhs._streambuf_wrapped;
+				_fd = rhs._fd;
 				_mbstate = rhs._mbstate;
 				_vecbuf_buffer = rhs._vecbuf_buffer;
-				StreambufType::setp(
-					StreambufType::pbase() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::pptr() ? _vecbuf_buffer.data() + (StreambufType::pptr() - StreambufType::pbase()) : nullptr,
-					StreambufType::epptr() ? _vecbuf_buffer.data() + (StreambufType::epptr() - StreambufType::pbase()) : nullptr
-				);
+				_vecbuf_conv.resize(rhs._vecbuf_conv.size());
+				_rebasePutArea(rhs);
 				return *this;
 			}
 			ConvertedOstreamBuf& operator=(ConvertedOstreamBuf&& rhs) {
 				static_cast<StreambufType&>(*this) = std::move(static_cast<StreambufType&>(rhs));
 				_streambuf_wrapped = std::move(rhs._streambuf_wrapped);
+				_fd = rhs._fd;
 				_mbstate = std::move(rhs._mbstate);
 				_vecbuf_buffer = std::move(rhs._vecbuf_buffer);
-				StreambufType::setp(
-					StreambufType::pbase() ? _vecbuf_buffer.data() : nullptr,
-					StreambufType::pptr() ? _vecbuf_buffer.data() + (StreambufType::pptr() - StreambufType::pbase()) : nullptr,
-					StreambufType::epptr() ? _vecbuf_buffer.data() + (StreambufType::epptr() - StreambufType::pbase()) : nullptr
-				);
+				_vecbuf_conv = std::move(rhs._vecbuf_conv);
+				_rebasePutArea(*this);
+				rhs._streambuf_wrapped = nullptr;
+				rhs._fd = -1;
+				rhs.StreambufType::setp(nullptr, nullptr);
 				return *this;
 			}
 		protected:
-			StreambufType* _streambuf_wrapped = nullptr;
+			MBStreambufType* _streambuf_wrapped = nullptr;
+			int _fd = -1;
 			mbstate_t _mbstate{};
+			/**
+			 * The characters buffered.
+			 */
 			std::vector<char_type> _vecbuf_buffer;
+			/**
+			 * The bytes converted from them.
+			 */
+			std::vector<char> _vecbuf_conv;
 			virtual int_type overflow(int_type int_ch = traits_type::eof()) override {
-				assert(_streambuf_wrapped);
-				std::string mbstr;
-				if (StreambufType::pptr() != StreambufType::pbase()) {
-					mbstr = toMBStringRestartable<std::allocator<char>>(StringViewType(StreambufType::pbase(), StreambufType::pptr()), _mbstate);
-				}
-				if (!traits_type::eq_int_type(int_ch, traits_type::eof())) {
-					char_type ch = traits_type::to_char_type(int_ch);
-					mbstr += toMBStringRestartable<std::allocator<char>>(StringViewType(&ch, 1), _mbstate);
-				}
-				assert(mbstr.size() <= std::numeric_limits<std::streamsize>::max());
-				std::streamsize size_put = _streambuf_wrapped->sputn(mbstr.data(), static_cast<std::streamsize>(mbstr.size()));
-				if (size_put == mbstr.size()) {
-					StreambufType::setp(StreambufType::pbase(), StreambufType::epptr());
-					return traits_type::not_eof(traits_type::eof());
-				} else {
-					StreambufType::setp(nullptr, nullptr);
-					return traits_type::eof();
+				if (traits_type::eq_int_type(int_ch, traits_type::eof()))
+					return _flush(nullptr, 0) ? traits_type::not_eof(int_ch) : traits_type::eof();
+				char_type ch = traits_type::to_char_type(int_ch);
+				if (StreambufType::pptr() != StreambufType::epptr()) {
+					*StreambufType::pptr() = ch;
+					StreambufType::pbump(1);
+					return int_ch;
 				}
+				return _flush(&ch, 1) ? int_ch : traits_type::eof();
 			}
 			virtual std::streamsize xsputn(const char_type* ptr, std::streamsize size_put) override {
-				const char_type* ptr_temp = ptr;
-				std::streamsize size_put_remaining = size_put;
-				while (size_put_remaining > 0) {
-					std::streamsize size_copy = std::min(size_put_remaining, StreambufType::epptr() - StreambufType::pptr());
-					assert(size_copy >= 0);
-					if (size_copy > 0) {
-						assert(ptr);
-						std::copy(ptr_temp, ptr_temp + size_copy, StreambufType::pptr());
-						StreambufType::setp(StreambufType::pbase(), StreambufType::pptr() + size_copy, StreambufType::epptr());
-						ptr_temp += size_copy;
-						size_put_remaining -= size_copy;
-					}
-					if (traits_type::eq_int_type(overflow(), traits_type::eof())) break;
-					assert(StreambufType::pptr() && StreambufType::pptr() != StreambufType::epptr());
+				if (size_put <= 0) return 0;
+				if (size_put <= StreambufType::epptr() - StreambufType::pptr()) {
+					traits_type::copy(StreambufType::pptr(), ptr, static_cast<std::size_t>(size_put));
+					StreambufType::pbump(static_cast<int>(size_put));
+					return size_put;
 				}
-				assert(size_put_remaining >= 0);
-				return size_put - size_put_remaining;
+				return _flush(ptr, static_cast<std::size_t>(size_put)) ? size_put : 0;
 			}
 			virtual int sync() override {
-				assert(_streambuf_wrapped);
-				overflow();
-				_streambuf_wrapped->pubsync();
-				return 0;
+				bool is_ok = _flush(nullptr, 0);
+				if (_streambuf_wrapped && _streambuf_wrapped->pubsync() == -1) is_ok = false;
+				return is_ok ? 0 : -1;
 			}
 		private:
-			static constexpr std::size_t _size_buffer = 0x100;
+			/**
+			 * Converts the buffered characters, followed by size_extra more,
+			 * and writes the bytes at once.  The buffer is emptied even if
+			 * the write fails.
+			 */
+			bool _flush(const char_type* p_extra, std::size_t size_extra) {
+				std::size_t size_pending = static_cast<std::size_t>(StreambufType::pptr() - StreambufType::pbase());
+				StreambufType::setp(_vecbuf_buffer.data(), _vecbuf_buffer.data() + _vecbuf_buffer.size());
+				if (!size_pending && !size_extra) return true;
+				std::size_t size_conv_max = maxMBSize(size_pending + size_extra);
+				if (_vecbuf_conv.size() < size_conv_max) _vecbuf_conv.resize(size_conv_max);
+				std::size_t size_conv = toMBStringRestartable(StringViewType(_vecbuf_buffer.data(), size_pending), _mbstate, _vecbuf_conv.data());
+				if (size_extra)
+					size_conv += toMBStringRestartable(StringViewType(p_extra, size_extra), _mbstate, _vecbuf_conv.data() + size_conv);
+				return _write(_vecbuf_conv.data(), size_conv);
+			}
+			bool _write(const char* p_mbs, std::size_t size_mbs) {
+				if (_fd < 0) {
+					if (!_streambuf_wrapped) return false;
+					assert(size_mbs <= static_cast<std::size_t>(std::numeric_limits<std::streamsize>::max()));
+					return _streambuf_wrapped->sputn(p_mbs, static_cast<std::streamsize>(size_mbs)) == static_cast<std::streamsize>(size_mbs);
+				}
+				return FdWriter::write(_fd, p_mbs, size_mbs);
+			}
+			/**
+			 * Points the put area, copied or moved from rhs, into the buffer.
+			 */
+			void _rebasePutArea(const ConvertedOstreamBuf& rhs) {
+				if (!StreambufType::pbase()) return;
+				std::ptrdiff_t offset_begin = StreambufType::pbase() - rhs._vecbuf_buffer.data();
+				std::ptrdiff_t offset_next = StreambufType::pptr() - StreambufType::pbase();
+				std::ptrdiff_t offset_end = StreambufType::epptr() - StreambufType::pbase();
+				StreambufType::setp(_vecbuf_buffer.data() + offset_begin, _vecbuf_buffer.data() + offset_begin + offset_end);
+				StreambufType::pbump(static_cast<int>(offset_next));
+			}
 		};
 		class ConvertedIstream final : public IstreamType {
 		public:
@@ -519,28 +775,30 @@ namespace TCLAP {
 			using int_type = typename T_CharTraits::int_type;
 			using pos_type = typename T_CharTraits::pos_type;
 			using off_type = typename T_CharTraits::off_type;
-			explicit ConvertedIstream(StreambufType* streambuf_wrapped)
+			explicit ConvertedIstream(MBStreambufType* streambuf_wrapped, std::size_t size_buffer = ConvertedIstreamBuf::defaultBufferSize)
 				: IstreamType(nullptr),
-				_streambuf(streambuf_wrapped) {
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
+				_streambuf(streambuf_wrapped, size_buffer) {
+				// The base is constructed before _streambuf, with no
+				// buffer and so with badbit set, which init clears.
+				IstreamType::init(&_streambuf);
 			}
 			ConvertedIstream(const ConvertedIstream&) = delete;
 			ConvertedIstream(ConvertedIstream&& rhs)
 				: IstreamType(std::move(static_cast<IstreamType&>(rhs))),
 				_streambuf(std::move(rhs._streambuf)) {
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
-				rhs.basic_ios<T_Char, T_CharTraits>::set_rdbuf(&rhs._streambuf);
+				IstreamType::set_rdbuf(&_streambuf);
+				rhs.IstreamType::set_rdbuf(&rhs._streambuf);
 			}
 			virtual ~ConvertedIstream() override = default;
 			ConvertedIstream& operator=(const ConvertedIstream&) = delete;
 			ConvertedIstream& operator=(ConvertedIstream&& rhs) {
 				static_cast<IstreamType&>(*this) = std::move(static_cast<IstreamType&>(rhs));
 				_streambuf = std::move(rhs._streambuf);
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
-				rhs.basic_ios<T_Char, T_CharTraits>::set_rdbuf(&rhs._streambuf);
+				IstreamType::set_rdbuf(&_streambuf);
+				rhs.IstreamType::set_rdbuf(&rhs._streambuf);
 				return *this;
 			}
-			ConvertedIstreamBuf* rdbuf() const { return &_streambuf; }
+			ConvertedIstreamBuf* rdbuf() const { return const_cast<ConvertedIstreamBuf*>(&_streambuf); }
 		protected:
 			ConvertedIstreamBuf _streambuf;
 		};
@@ -551,28 +809,33 @@ namespace TCLAP {
 			using int_type = typename T_CharTraits::int_type;
 			using pos_type = typename T_CharTraits::pos_type;
 			using off_type = typename T_CharTraits::off_type;
-			explicit ConvertedOstream(StreambufType* streambuf_wrapped)
+			explicit ConvertedOstream(MBStreambufType* streambuf_wrapped, std::size_t size_buffer = ConvertedOstreamBuf::defaultBufferSize)
 				: OstreamType(nullptr),
-				_streambuf(streambuf_wrapped) {
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
+				_streambuf(streambuf_wrapped, size_buffer) {
+				OstreamType::init(&_streambuf);
+			}
+			explicit ConvertedOstream(int fd, std::size_t size_buffer = ConvertedOstreamBuf::defaultBufferSize)
+				: OstreamType(nullptr),
+				_streambuf(fd, size_buffer) {
+				OstreamType::init(&_streambuf);
 			}
 			ConvertedOstream(const ConvertedOstream&) = delete;
 			ConvertedOstream(ConvertedOstream&& rhs)
 				: OstreamType(std::move(static_cast<OstreamType&>(rhs))),
 				_streambuf(std::move(rhs._streambuf)) {
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
-				rhs.basic_ios<T_Char, T_CharTraits>::set_rdbuf(&rhs._streambuf);
+				OstreamType::set_rdbuf(&_streambuf);
+				rhs.OstreamType::set_rdbuf(&rhs._streambuf);
 			}
 			virtual ~ConvertedOstream() override = default;
 			ConvertedOstream& operator=(const ConvertedOstream&) = delete;
 			ConvertedOstream& operator=(ConvertedOstream&& rhs) {
 				static_cast<OstreamType&>(*this) = std::move(static_cast<OstreamType&>(rhs));
 				_streambuf = std::move(rhs._streambuf);
-				basic_ios<T_Char, T_CharTraits>::set_rdbuf(&_streambuf);
-				rhs.basic_ios<T_Char, T_CharTraits>::set_rdbuf(&rhs._streambuf);
+				OstreamType::set_rdbuf(&_streambuf);
+				rhs.OstreamType::set_rdbuf(&rhs._streambuf);
 				return *this;
 			}
-			ConvertedOstreamBuf* rdbuf() const { return &_streambuf; }
+			ConvertedOstreamBuf* rdbuf() const { return const_cast<ConvertedOstreamBuf*>(&_streambuf); }
 		protected:
 			ConvertedOstreamBuf _streambuf;
 		};
@@ -619,6 +882,14 @@ namespace TCLAP {
 			std::array<char, size_arr_basic_from - 1> arr_str_to = fromConstBasicCharArray(arr_basic_from);
 			return StringTypeTmpl<T_Alloc>(arr_str_to.data(), arr_str_to.size(), alloc);
 		}
+		/**
+		 * A view of a string of basic characters from the pool of constant
+		 * strings, which doesn't allocate, unlike fromConstBasicCharString.
+		 */
+		template<BasicCharLiteral str_basic>
+		static constexpr StringViewType constBasicString() {
+			return StringViewType(constBasicCharArray<CharType, CharTraitsType, str_basic>.data(), constBasicCharArray<CharType, CharTraitsType, str_basic>.size());
+		}
 		static std::size_t toMBCharRestartable(char(&mbch)[MB_LEN_MAX], const CharType& ch, std::mbstate_t& mbstate) {
 			static_cast<void>(mbstate);
 			mbch[0] = ch;
@@ -630,6 +901,48 @@ namespace TCLAP {
 			ch = p_mbs[0];
 			return 1;
 		}
+		static constexpr std::size_t maxMBSize(std::size_t size) {
+			return size;
+		}
+		static constexpr std::size_t maxFromMBSize(std::size_t size_mbs) {
+			return size_mbs;
+		}
+		static std::size_t toMBStringRestartable(const StringViewType& strview, mbstate_t& mbstate, char* p_out) {
+			static_cast<void>(mbstate);
+			CharTraitsType::copy(p_out, strview.data(), strview.size());
+			return strview.size();
+		}
+		static std::size_t fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, mbstate_t& mbstate, CharType* p_out) {
+			static_cast<void>(mbstate);
+			CharTraitsType::copy(p_out, strview.data(), strview.size());
+			return strview.size();
+		}
+		static std::size_t toMBString(const StringViewType& strview, char* p_out) {
+			mbstate_t mbstate{};
+			return toMBStringRestartable(strview, mbstate, p_out);
+		}
+		static std::size_t fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview, CharType* p_out) {
+			mbstate_t mbstate{};
+			return fromMBStringRestartable(strview, mbstate, p_out);
+		}
+		template<typename T_Alloc>
+		static void toMBStringRestartable(const StringViewType& strview, mbstate_t& mbstate, std::basic_string<char, std::char_traits<char>, T_Alloc>& str) {
+			static_cast<void>(mbstate);
+			str.append(strview);
+		}
+		template<typename T_Alloc>
+		static void fromMBStringRestartable(const std::basic_string_view<char, std::char_traits<char>>& strview, mbstate_t& mbstate, StringTypeTmpl<T_Alloc>& str) {
+			static_cast<void>(mbstate);
+			str.append(strview);
+		}
+		template<typename T_Alloc>
+		static void toMBString(const StringViewType& strview, std::basic_string<char, std::char_traits<char>, T_Alloc>& str) {
+			str.append(strview);
+		}
+		template<typename T_Alloc>
+		static void fromMBString(const std::basic_string_view<char, std::char_traits<char>>& strview, StringTypeTmpl<T_Alloc>& str) {
+			str.append(strview);
+		}
 		template<typename T_Alloc = std::allocator<char>>
 		static std::basic_string<char, std::char_traits<char>, T_Alloc> toMBStringRestartable(const StringViewType& strview, mbstate_t& mbstate) {
 			static_cast<void>(mbstate);
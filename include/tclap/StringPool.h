@@ -0,0 +1,170 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  StringPool.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_STRINGPOOL_H
+#define TCLAP_STRINGPOOL_H
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <list>
+#include <unordered_set>
+#include <functional>
+
+#include <tclap/UseAllocatorBase.h>
+
+namespace TCLAP {
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class StringPool;
+
+	/**
+	 * FNV-1a over the integer values of the characters, so that strings
+	 * with any T_CharTraits can be hashed.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>>
+	struct StringHash {
+		std::size_t operator()(std::basic_string_view<T_Char, T_CharTraits> s) const noexcept {
+			std::size_t h = static_cast<std::size_t>(14695981039346656037ull);
+			for (const T_Char& ch : s) {
+				h ^= static_cast<std::size_t>(T_CharTraits::to_int_type(ch));
+				h *= static_cast<std::size_t>(1099511628211ull);
+			}
+			return h;
+		}
+	};
+
+	/**
+	 * An interning arena for the text of Args.  Strings are copied into
+	 * large contiguous chunks and handed back as views, and every distinct
+	 * string is stored only once.  The views stay valid until the pool is
+	 * cleared or destroyed.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class StringPool : public UseAllocatorBase<T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using typename UseAllocatorBase<T_Alloc>::AllocatorTraitsType;
+		using CharType = T_Char;
+		using CharTraitsType = T_CharTraits;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+		using UseAllocatorBase<T_Alloc>::rebindAlloc;
+
+		/**
+		 * The number of characters reserved for each chunk by default.
+		 */
+		static constexpr std::size_t sizeChunkDefault = 0x1000;
+
+		StringPool(const StringPool& rhs) = delete;
+		StringPool& operator=(const StringPool& rhs) = delete;
+
+		/**
+		 * Constructor.
+		 * \param sizeChunk - The number of characters reserved for each
+		 * chunk of the arena.  Strings longer than this get a chunk of
+		 * their own.
+		 */
+		explicit StringPool(std::size_t sizeChunk = sizeChunkDefault, const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Returns a view of a pooled copy of s.  Equal strings always
+		 * yield the same view.
+		 * \param s - The string to be interned.
+		 */
+		StringViewType intern(StringViewType s);
+
+		/**
+		 * Returns the number of distinct strings in the pool.
+		 */
+		std::size_t count() const { return _index.size(); }
+
+		/**
+		 * Returns the number of characters stored in the pool.
+		 */
+		std::size_t size() const { return _size_used; }
+
+		/**
+		 * Releases all storage.  Invalidates every view handed out.
+		 */
+		void clear();
+
+	private:
+		/**
+		 * Chunks are never resized once created, so views into them stay
+		 * valid.  A list is used so that chunks never move either.
+		 */
+		using ChunkListType = std::list<StringType, typename std::allocator_traits<AllocatorType>::template rebind_alloc<StringType>>;
+		using IndexType = std::unordered_set<StringViewType, StringHash<T_Char, T_CharTraits>, std::equal_to<StringViewType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<StringViewType>>;
+
+		std::size_t _size_chunk;
+		std::size_t _size_used;
+		ChunkListType _chunks;
+		IndexType _index;
+	};
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline StringPool<T_Char, T_CharTraits, T_Alloc>::StringPool(std::size_t sizeChunk, const AllocatorType& alloc)
+		: UseAllocatorBase<T_Alloc>(alloc),
+		_size_chunk(sizeChunk ? sizeChunk : 1),
+		_size_used(0),
+		_chunks(alloc),
+		_index(alloc) {
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto StringPool<T_Char, T_CharTraits, T_Alloc>::intern(StringViewType s) -> StringViewType {
+		if (s.empty()) return StringViewType();
+
+		typename IndexType::const_iterator it = _index.find(s);
+		if (it != _index.end()) return *it;
+
+		// Append to the current chunk if it has room, otherwise start
+		// a new one.  A chunk never grows past its reserved capacity.
+		StringType* chunk = _chunks.empty() ? nullptr : &_chunks.back();
+		if (!chunk || chunk->capacity() - chunk->size() < s.size()) {
+			_chunks.emplace_back(getAlloc());
+			chunk = &_chunks.back();
+			chunk->reserve(std::max(_size_chunk, s.size()));
+		}
+		std::size_t offset = chunk->size();
+		chunk->append(s);
+		_size_used += s.size();
+
+		StringViewType pooled(chunk->data() + offset, s.size());
+		_index.insert(pooled);
+		return pooled;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void StringPool<T_Char, T_CharTraits, T_Alloc>::clear() {
+		_index.clear();
+		_chunks.clear();
+		_size_used = 0;
+	}
+
+} //namespace TCLAP
+
+#endif
@@ -0,0 +1,371 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  SubcommandArg.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_SUBCOMMAND_ARG_H
+#define TCLAP_SUBCOMMAND_ARG_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+
+#include <tclap/StringConvert.h>
+#include <tclap/StringPool.h>
+#include <tclap/Arg.h>
+#include <tclap/OptionalUnlabeledTracker.h>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class SubcommandArg;
+
+	/**
+	 * An unlabeled argument that selects a subcommand.  Each subcommand
+	 * is registered as a factory that builds its own CmdLine.  When the
+	 * name of a subcommand is matched, all following args are set aside
+	 * for it, and only that subcommand's CmdLine is built and parsed,
+	 * by parse().  Args added to the enclosing CmdLine are shared by all
+	 * subcommands and must precede the subcommand name.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class SubcommandArg : public Arg<T_Char, T_CharTraits, T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using typename UseAllocatorBase<T_Alloc>::AllocatorTraitsType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CharType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CharTraitsType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgVectorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListIteratorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgVectorIteratorType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
+		using FactoryType = std::function<std::unique_ptr<CmdLineInterfaceType>()>;
+		using FactoryMapType = std::unordered_map<StringType, FactoryType, StringHash<T_Char, T_CharTraits>, std::equal_to<StringType>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::pair<const StringType, FactoryType>>>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+		using UseAllocatorBase<T_Alloc>::rebindAlloc;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::addToList;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::beginIgnoring;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::ignoreRest;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::delimiter;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::blankChar;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::flagStartChar;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::flagStartString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::nameStartString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::ignoreNameString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::setDelimiter;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::processArg;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::operator==;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getFlag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getName;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::getDescription;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::forceRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::xorSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isValueRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::isIgnoreable;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::argMatches;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::toString;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::shortID;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::longID;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::trimFlag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_hasBlanks;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::setRequireLabel;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::allowMore;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::acceptsMultipleValues;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::reset;
+
+		SubcommandArg(const SubcommandArg& rhs) = delete;
+		SubcommandArg& operator=(const SubcommandArg& rhs) = delete;
+
+		/**
+		 * SubcommandArg constructor.
+		 * \param name - A one word name for the argument.  Note that this is used for
+		 * identification, not as a long flag.
+		 * \param desc - A description of what the argument is for or
+		 * does.
+		 * \param req - Whether a subcommand is required on the command
+		 * line.
+		 * \param parser - A CmdLine parser object to add this Arg to.
+		 * \param v - Optional Visitor.  You should leave this blank unless
+		 * you have a very good reason.
+		 */
+		SubcommandArg(const StringType& name,
+			const DescriptionType& desc,
+			bool req,
+			CmdLineInterfaceType& parser,
+			Visitor* v = nullptr,
+			const AllocatorType& alloc = AllocatorType());
+
+		/**
+		 * Registers a subcommand.  The factory is only called if the
+		 * subcommand is selected on the command line, so the Args of the
+		 * other subcommands are never constructed.
+		 * \param name - The name selecting the subcommand.
+		 * \param factory - Builds the CmdLine of the subcommand, with
+		 * all of its Args added.
+		 */
+		void add(const StringType& name, FactoryType factory);
+
+		/**
+		 * Handles the processing of the argument.  Matches the name of a
+		 * registered subcommand and sets aside all args that follow it.
+		 * \param idx_arg - Pointer the the current argument in the list.
+		 * \param args - Mutable list of strings. Passed
+		 * in from main().
+		 */
+		virtual bool processArg(std::size_t& idx_arg, StringVectorType& args) override;
+
+		/**
+		 * Builds the CmdLine of the selected subcommand and parses the
+		 * args that followed its name.  Call this after the enclosing
+		 * CmdLine has been parsed.  Returns nullptr if no subcommand was
+		 * given.
+		 */
+		CmdLineInterfaceType* parse();
+
+		/**
+		 * Returns the name of the selected subcommand.
+		 */
+		const StringType& getValue() const { return _value; }
+
+		/**
+		 * Returns the CmdLine of the selected subcommand, or nullptr if
+		 * parse() has not built one.
+		 */
+		CmdLineInterfaceType* getCmdLine() const { return _cmd.get(); }
+
+		/**
+		 * Returns the number of registered subcommands.
+		 */
+		std::size_t count() const { return _factories.size(); }
+
+		/**
+		 * Lists the names of the registered subcommands.
+		 */
+		virtual StringType shortID(const StringType& val = StringConvertType::fromConstBasicCharString("val")) const override;
+
+		/**
+		 * Overrides longID for specific behavior.
+		 */
+		virtual StringType longID(const StringType& val = StringConvertType::fromConstBasicCharString("val")) const override;
+
+		/**
+		 * Overrides operator== for specific behavior.
+		 */
+		virtual bool operator==(const ArgType& a) const override;
+
+		/**
+		 * Instead of pushing to the front of list, push to the back.
+		 * \param argList - The list to add this to.
+		 */
+		virtual void addToList(ArgListType& argList) const override;
+
+		virtual void reset() override;
+
+	protected:
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_flag;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_name;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_description;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_required;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_requireLabel;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_valueRequired;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_alreadySet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_visitor;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_ignoreable;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_xorSet;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_acceptsMultipleValues;
+		using Arg<T_Char, T_CharTraits, T_Alloc>::_checkWithVisitor;
+
+		/**
+		 * The CmdLine this Arg was added to.  Used for the program name.
+		 */
+		CmdLineInterfaceType* _parser;
+
+		/**
+		 * The registered subcommands, by name.
+		 */
+		FactoryMapType _factories;
+
+		/**
+		 * The name of the selected subcommand.
+		 */
+		StringType _value;
+
+		/**
+		 * The args following the subcommand name.  The first element is
+		 * the program name shown in the usage of the subcommand.
+		 */
+		StringVectorType _args;
+
+		/**
+		 * The CmdLine of the selected subcommand.
+		 */
+		std::unique_ptr<CmdLineInterfaceType> _cmd;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN SubcommandArg.cpp
+	//////////////////////////////////////////////////////////////////////
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline SubcommandArg<T_Char, T_CharTraits, T_Alloc>::SubcommandArg(const StringType& name,
+		const DescriptionType& desc,
+		bool req,
+		CmdLineInterfaceType& parser,
+		Visitor* v,
+		const AllocatorType& alloc)
+		: Arg<T_Char, T_CharTraits, T_Alloc>(StringType(), name, desc, req, true, v, alloc),
+		_parser(&parser),
+		_factories(alloc),
+		_value(alloc),
+		_args(alloc),
+		_cmd() {
+		_ignoreable = false;
+		OptionalUnlabeledTracker<T_Char, T_CharTraits, T_Alloc>::check(req, toString());
+		parser.add(this);
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void SubcommandArg<T_Char, T_CharTraits, T_Alloc>::add(const StringType& name, FactoryType factory) {
+		if (!_factories.emplace(name, std::move(factory)).second)
+			throw(SpecificationException<T_Char, T_CharTraits, T_Alloc>(
+				StringConvertType::fromConstBasicCharString("Subcommand with same name already exists!"),
+				name));
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline bool SubcommandArg<T_Char, T_CharTraits, T_Alloc>::processArg(std::size_t& idx_arg, StringVectorType& args) {
+		if (_alreadySet)
+			return false;
+
+		if (_factories.find(args[idx_arg]) == _factories.end())
+			return false;
+
+		_value = args[idx_arg];
+		_args.clear();
+		_args.reserve(args.size() - idx_arg);
+		_args.push_back(_parser->getProgramName());
+		_args.back() += StringConvertType::fromConstBasicChar(' ');
+		_args.back() += _value;
+		for (std::size_t i = idx_arg + 1; i < args.size(); i++)
+			_args.push_back(std::move(args[i]));
+		args.resize(idx_arg + 1);
+
+		_alreadySet = true;
+		_checkWithVisitor();
+		return true;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto SubcommandArg<T_Char, T_CharTraits, T_Alloc>::parse() -> CmdLineInterfaceType* {
+		if (!_alreadySet)
+			return nullptr;
+
+		// The Args of the subcommand form a spec of their own, so they
+		// are checked from a clean tracker, which is then put back for
+		// the enclosing CmdLine.
+		bool& optional = OptionalUnlabeledTracker<T_Char, T_CharTraits, T_Alloc>::alreadyOptional();
+		const bool optionalOuter = optional;
+		optional = false;
+		try {
+			_cmd = _factories.find(_value)->second();
+		} catch (...) {
+			optional = optionalOuter;
+			throw;
+		}
+		optional = optionalOuter;
+
+		_cmd->parse(_args);
+		return _cmd.get();
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto SubcommandArg<T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
+		static_cast<void>(val); // Ignore input, don't warn
+		// The map is unordered, so sort the names for a stable usage.
+		std::vector<const StringType*, typename std::allocator_traits<AllocatorType>::template rebind_alloc<const StringType*>> names(getAlloc());
+		names.reserve(_factories.size());
+		for (const auto& factory : _factories)
+			names.push_back(&factory.first);
+		std::sort(names.begin(), names.end(), [](const StringType* a, const StringType* b) { return *a < *b; });
+
+		StringType id = StringConvertType::fromConstBasicCharString("<");
+		for (std::size_t i = 0; i < names.size(); i++) {
+			if (i > 0)
+				id += StringConvertType::fromConstBasicChar('|');
+			id += *names[i];
+		}
+		if (names.empty())
+			id += _name;
+		id += StringConvertType::fromConstBasicCharString("> ...");
+		return id;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto SubcommandArg<T_Char, T_CharTraits, T_Alloc>::longID(const StringType& val) const -> StringType {
+		static_cast<void>(val); // Ignore input, don't warn
+		StringType id = StringConvertType::fromConstBasicCharString("<");
+		id += _name;
+		id += StringConvertType::fromConstBasicCharString(">");
+		return id;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline bool SubcommandArg<T_Char, T_CharTraits, T_Alloc>::operator==(const ArgType& a) const {
+		// Only the names, as comparing descriptions would run their
+		// loaders.
+		if (_name == a.getName())
+			return true;
+		else
+			return false;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void SubcommandArg<T_Char, T_CharTraits, T_Alloc>::addToList(ArgListType& argList) const {
+		argList.push_back(const_cast<ArgType*>(static_cast<const ArgType* const>(this)));
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void SubcommandArg<T_Char, T_CharTraits, T_Alloc>::reset() {
+		Arg<T_Char, T_CharTraits, T_Alloc>::reset();
+		_value.clear();
+		_args.clear();
+		_cmd.reset();
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//END SubcommandArg.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
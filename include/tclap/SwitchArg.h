@@ -52,6 +52,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -107,7 +108,7 @@ namespace TCLAP {
 		 */
 		SwitchArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool def = false,
 			Visitor* v = nullptr,
 			const AllocatorType& alloc = AllocatorType());
@@ -128,7 +129,7 @@ namespace TCLAP {
 		 */
 		SwitchArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			CmdLineInterfaceType& parser,
 			bool def = false,
 			Visitor* v = nullptr,
@@ -190,17 +191,17 @@ namespace TCLAP {
 		 */
 		bool _default;
 
+		/**
+		 * Does the common processing of processArg.
+		 */
+		void commonProcessing();
+
 	private:
 		/**
 		 * Checks to see if we've found the last match in
 		 * a combined string.
 		 */
 		bool lastCombined(StringType& combined);
-
-		/**
-		 * Does the common processing of processArg.
-		 */
-		void commonProcessing();
 	};
 
 	//////////////////////////////////////////////////////////////////////
@@ -209,7 +210,7 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline SwitchArg<T_Char, T_CharTraits, T_Alloc>::SwitchArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool default_val,
 		Visitor* v,
 		const AllocatorType& alloc)
@@ -221,7 +222,7 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline SwitchArg<T_Char, T_CharTraits, T_Alloc>::SwitchArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		CmdLineInterfaceType& parser,
 		bool default_val,
 		Visitor* v,
@@ -234,7 +235,8 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline bool SwitchArg<T_Char, T_CharTraits, T_Alloc>::lastCombined(StringType& combinedSwitches) {
-		for (const CharType& ch_combinedSwitches : combinedSwitches) if (ch_combinedSwitches != Arg<T_Char, T_CharTraits, T_Alloc>::blankChar()) return false;
+		// skip the leading flag start char
+		for (std::size_t i = 1; i < combinedSwitches.size(); i++) if (combinedSwitches[i] != Arg<T_Char, T_CharTraits, T_Alloc>::blankChar()) return false;
 		return true;
 	}
 
@@ -306,6 +308,7 @@ namespace TCLAP {
 				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(StringConvertType::fromConstBasicCharString("Argument already set!"), toString()));
 
 			commonProcessing();
+			ParseEventSink<T_Char, T_CharTraits, T_Alloc>::argMatchedInCombined(*this);
 
 			// We only want to return true if we've found the last combined
 			// match in the string, otherwise we return true so that other 
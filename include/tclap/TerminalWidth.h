@@ -0,0 +1,109 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  TerminalWidth.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_TERMINAL_WIDTH_H
+#define TCLAP_TERMINAL_WIDTH_H
+
+#include <atomic>
+#include <cstddef>
+#ifndef _WIN32
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace TCLAP {
+
+	/**
+	 * The width in columns of the terminal that the usage is printed
+	 * to.  The terminal on stdout or stderr, whichever the usage is
+	 * written to, is queried with ioctl(TIOCGWINSZ) the first time its
+	 * width is needed, and the answer is kept for the rest of the
+	 * program.  When that is not a terminal, when the usage is written
+	 * to some other stream, or on Windows, where there is no such
+	 * query, the width is widthDefault, so that redirected output
+	 * doesn't depend on where the program was run.  set() overrides the
+	 * width, for instance to render the usage for another screen.
+	 */
+	class TerminalWidth {
+	public:
+		/**
+		 * The width when it can't be queried.
+		 */
+		static constexpr std::size_t widthDefault = 80;
+
+		/**
+		 * The file descriptors of stdout and stderr, and the one for
+		 * any other stream.
+		 */
+		static constexpr int fdStdout = 1;
+		static constexpr int fdStderr = 2;
+		static constexpr int fdNone = -1;
+
+		/**
+		 * Returns the width set with set(), or else the width of the
+		 * terminal on fd.
+		 * \param fd - fdStdout, fdStderr or fdNone.
+		 */
+		static std::size_t get(int fd = fdStdout) noexcept {
+			std::size_t columns = _override.load(std::memory_order_relaxed);
+			if (columns) return columns;
+			if (fd == fdStdout) {
+				static const std::size_t queriedStdout = _query(fdStdout);
+				return queriedStdout;
+			}
+			if (fd == fdStderr) {
+				static const std::size_t queriedStderr = _query(fdStderr);
+				return queriedStderr;
+			}
+			return widthDefault;
+		}
+
+		/**
+		 * Overrides the width of the terminal.
+		 * \param columns - The width, or 0 to use the terminal's again.
+		 */
+		static void set(std::size_t columns) noexcept {
+			_override.store(columns, std::memory_order_relaxed);
+		}
+
+	private:
+		/**
+		 * Asks the terminal on fd for its width.
+		 */
+		static std::size_t _query(int fd) noexcept {
+#if !defined(_WIN32) && defined(TIOCGWINSZ)
+			struct winsize size = {};
+			if (::ioctl(fd, TIOCGWINSZ, &size) == 0 && size.ws_col > 0)
+				return size.ws_col;
+#else
+			static_cast<void>(fd);
+#endif
+			return widthDefault;
+		}
+
+		static inline std::atomic<std::size_t> _override{0};
+	};
+
+} //namespace TCLAP
+
+#endif
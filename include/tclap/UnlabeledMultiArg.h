@@ -53,6 +53,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -122,7 +123,7 @@ namespace TCLAP {
 		 * use this unless you have a very good reason.
 		 */
 		UnlabeledMultiArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			const StringType& typeDesc,
 			bool ignoreable = false,
@@ -147,7 +148,7 @@ namespace TCLAP {
 		 * use this unless you have a very good reason.
 		 */
 		UnlabeledMultiArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			const StringType& typeDesc,
 			CmdLineInterfaceType& parser,
@@ -171,7 +172,7 @@ namespace TCLAP {
 		 * use this unless you have a very good reason.
 		 */
 		UnlabeledMultiArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			ConstraintType* constraint,
 			bool ignoreable = false,
@@ -195,7 +196,7 @@ namespace TCLAP {
 		 * use this unless you have a very good reason.
 		 */
 		UnlabeledMultiArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			ConstraintType* constraint,
 			CmdLineInterfaceType& parser,
@@ -258,7 +259,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledMultiArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		const StringType& typeDesc,
 		bool ignoreable,
@@ -271,7 +272,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledMultiArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		const StringType& typeDesc,
 		CmdLineInterfaceType& parser,
@@ -287,7 +288,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledMultiArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		ConstraintType* constraint,
 		bool ignoreable,
@@ -300,7 +301,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledMultiArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		ConstraintType* constraint,
 		CmdLineInterfaceType& parser,
@@ -342,18 +343,26 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	auto UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
 		static_cast<void>(val); // Ignore input, don't warn
-		return StringConvertType::fromConstBasicCharString("<") + _typeDesc + StringConvertType::fromConstBasicCharString("> ...");
+		StringType id(1, StringConvertType::fromConstBasicChar('<'));
+		id += _typeDesc;
+		id += StringConvertType::template constBasicString<"> ...">();
+		return id;
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	auto UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::longID(const StringType& val) const -> StringType {
 		static_cast<void>(val); // Ignore input, don't warn
-		return StringConvertType::fromConstBasicCharString("<") + _typeDesc + StringConvertType::fromConstBasicCharString(">  (accepted multiple times)");
+		StringType id(1, StringConvertType::fromConstBasicChar('<'));
+		id += _typeDesc;
+		id += StringConvertType::template constBasicString<">  (accepted multiple times)">();
+		return id;
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	bool UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>::operator==(const ArgType& a) const {
-		if (_name == a.getName() || _description == a.getDescription())
+		// Only the names, as comparing descriptions would run their
+		// loaders.
+		if (_name == a.getName())
 			return true;
 		else
 			return false;
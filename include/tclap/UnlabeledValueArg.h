@@ -56,6 +56,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -126,7 +127,7 @@ namespace TCLAP {
 		 * you have a very good reason.
 		 */
 		UnlabeledValueArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			const StringType& typeDesc,
@@ -157,7 +158,7 @@ namespace TCLAP {
 		 * you have a very good reason.
 		 */
 		UnlabeledValueArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			const StringType& typeDesc,
@@ -186,7 +187,7 @@ namespace TCLAP {
 		 * you have a very good reason.
 		 */
 		UnlabeledValueArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			ConstraintType* constraint,
@@ -216,7 +217,7 @@ namespace TCLAP {
 		 * you have a very good reason.
 		 */
 		UnlabeledValueArg(const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			ConstraintType* constraint,
@@ -281,7 +282,7 @@ namespace TCLAP {
 	 */
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledValueArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		const StringType& typeDesc,
@@ -297,7 +298,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledValueArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		const StringType& typeDesc,
@@ -316,7 +317,7 @@ namespace TCLAP {
 	 */
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledValueArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		ConstraintType* constraint,
@@ -330,7 +331,7 @@ namespace TCLAP {
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::UnlabeledValueArg(const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		ConstraintType* constraint,
@@ -369,7 +370,10 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	auto UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::shortID(const StringType& val) const -> StringType {
 		static_cast<void>(val); // Ignore input, don't warn
-		return StringConvertType::fromConstBasicCharString("<") + _typeDesc + StringConvertType::fromConstBasicCharString(">");
+		StringType id(1, StringConvertType::fromConstBasicChar('<'));
+		id += _typeDesc;
+		id += StringConvertType::fromConstBasicChar('>');
+		return id;
 	}
 
 	/**
@@ -382,7 +386,10 @@ namespace TCLAP {
 		// Ideally we would like to be able to use RTTI to return the name
 		// of the type required for this argument.  However, g++ at least, 
 		// doesn't appear to return terribly useful "names" of the types.  
-		return StringConvertType::fromConstBasicCharString("<") + _typeDesc + StringConvertType::fromConstBasicCharString(">");
+		StringType id(1, StringConvertType::fromConstBasicChar('<'));
+		id += _typeDesc;
+		id += StringConvertType::fromConstBasicChar('>');
+		return id;
 	}
 
 	/**
@@ -390,7 +397,9 @@ namespace TCLAP {
 	 */
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	bool UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>::operator==(const ArgType& a) const {
-		if (_name == a.getName() || _description == a.getDescription())
+		// Only the names, as comparing descriptions would run their
+		// loaders.
+		if (_name == a.getName())
 			return true;
 		else
 			return false;
@@ -0,0 +1,133 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  UsageCache.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_USAGECACHE_H
+#define TCLAP_USAGECACHE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <vector>
+
+#include <tclap/UseAllocatorBase.h>
+
+namespace TCLAP {
+	/**
+	 * The parts of the usage that an output has rendered for a CmdLine,
+	 * kept by the CmdLine so that repeated requests for the usage don't
+	 * render them again.  The text is stored per output class and part,
+	 * along with the program name and width it was rendered for, since
+	 * the program name is only known once a command line is parsed and
+	 * the width can be changed with TerminalWidth::set.  The CmdLine
+	 * clears the cache whenever Args are added; changes it can't see,
+	 * such as Arg::setDescription, need an explicit clear().
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class UsageCache : public UseAllocatorBase<T_Alloc> {
+	public:
+		using typename UseAllocatorBase<T_Alloc>::AllocatorType;
+		using StringViewType = std::basic_string_view<T_Char, T_CharTraits>;
+		using StringType = std::basic_string<T_Char, T_CharTraits, T_Alloc>;
+		using UseAllocatorBase<T_Alloc>::getAlloc;
+
+		/**
+		 * The parts of the usage that are cached.
+		 */
+		enum class Part {
+			ShortUsage,
+			LongUsage
+		};
+
+		explicit UsageCache(const AllocatorType& alloc = AllocatorType())
+			: UseAllocatorBase<T_Alloc>(alloc),
+			_entries(alloc) {
+		}
+
+		/**
+		 * Returns the text of a part rendered by an output class for a
+		 * program name and width, or null if it isn't cached.
+		 * \param output - The class of the output, typeid(*this).
+		 * \param part - The part of the usage.
+		 * \param progName - The program name the text is rendered for.
+		 * \param width - The width the text is wrapped to.
+		 */
+		const StringType* find(std::type_index output, Part part, StringViewType progName, std::size_t width) const;
+
+		/**
+		 * Stores the text of a part rendered by an output class for a
+		 * program name and width, replacing what was stored for them, and
+		 * returns the stored text.
+		 * \param output - The class of the output, typeid(*this).
+		 * \param part - The part of the usage.
+		 * \param progName - The program name the text is rendered for.
+		 * \param width - The width the text is wrapped to.
+		 * \param text - The rendered text.
+		 */
+		const StringType& store(std::type_index output, Part part, StringViewType progName, std::size_t width, StringType&& text);
+
+		/**
+		 * Forgets all the stored text.
+		 */
+		void clear() noexcept { _entries.clear(); }
+
+	private:
+		struct Entry {
+			std::type_index output;
+			Part part;
+			StringType progName;
+			std::size_t width;
+			StringType text;
+		};
+
+		/**
+		 * The stored parts, a handful at most, so they are searched in
+		 * order.
+		 */
+		std::vector<Entry, typename std::allocator_traits<AllocatorType>::template rebind_alloc<Entry>> _entries;
+	};
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto UsageCache<T_Char, T_CharTraits, T_Alloc>::find(std::type_index output, Part part, StringViewType progName, std::size_t width) const -> const StringType* {
+		for (const Entry& entry : _entries)
+			if (entry.output == output && entry.part == part)
+				return entry.progName == progName && entry.width == width ? &entry.text : nullptr;
+		return nullptr;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto UsageCache<T_Char, T_CharTraits, T_Alloc>::store(std::type_index output, Part part, StringViewType progName, std::size_t width, StringType&& text) -> const StringType& {
+		for (Entry& entry : _entries)
+			if (entry.output == output && entry.part == part) {
+				entry.progName.assign(progName);
+				entry.width = width;
+				entry.text = std::move(text);
+				return entry.text;
+			}
+		_entries.push_back(Entry{output, part, StringType(progName, getAlloc()), width, std::move(text)});
+		return _entries.back().text;
+	}
+
+} //namespace TCLAP
+#endif
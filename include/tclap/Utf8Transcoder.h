@@ -0,0 +1,335 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  Utf8Transcoder.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_UTF8TRANSCODER_H
+#define TCLAP_UTF8TRANSCODER_H
+
+#include <climits>
+#include <clocale>
+#include <cstring>
+#include <cstdint>
+#include <cuchar>
+#include <cwchar>
+#include <string>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TCLAP_UTF8_SSE2
+#endif
+
+namespace TCLAP {
+
+	/**
+	 * Transcodes between UTF-8 and UTF-16 or UTF-32 without going through
+	 * the locale one character at a time.  StringConvert uses it for
+	 * char16_t, char32_t and, where it holds UTF-16 or UTF-32, wchar_t
+	 * when the multibyte encoding of the current C locale is UTF-8, and
+	 * falls back to the mbstate routines for other encodings and for
+	 * whatever the transcoder leaves unread.
+	 *
+	 * Blocks of 16 ASCII characters are copied with SSE2 where it is
+	 * available, 8 at a time otherwise, and other characters are decoded
+	 * and validated one at a time.  Invalid input is replaced with one
+	 * U+FFFD for each byte that doesn't start a valid sequence and for each
+	 * unpaired surrogate, like the mbstate routines do, except that
+	 * overlong forms, encoded surrogates and code points above U+10FFFF,
+	 * which C libraries don't agree on, are always invalid.
+	 *
+	 * Define TCLAP_NO_UTF8_FAST_PATH to always use the mbstate routines.
+	 */
+	template<typename T_Char>
+	class Utf8Transcoder {
+	public:
+		using CharType = T_Char;
+#ifdef TCLAP_NO_UTF8_FAST_PATH
+		static constexpr bool enabled = false;
+#elif defined(_WIN32) || defined(__STDC_ISO_10646__)
+		// wchar_t holds UTF-16 on Windows and UTF-32 elsewhere.
+		static constexpr bool enabled = std::is_same<T_Char, char16_t>::value || std::is_same<T_Char, char32_t>::value || std::is_same<T_Char, wchar_t>::value;
+#else
+		static constexpr bool enabled = std::is_same<T_Char, char16_t>::value || std::is_same<T_Char, char32_t>::value;
+#endif
+
+		/**
+		 * Whether the multibyte encoding of the current C locale is UTF-8.
+		 * The answer is cached for each thread and worked out again when
+		 * the name of the LC_CTYPE locale changes, so a locale installed
+		 * for a thread with uselocale() isn't noticed.
+		 */
+		static bool isUtf8Locale();
+
+		/**
+		 * The most bytes encode writes for a character.
+		 */
+		static constexpr std::size_t maxBytesPerChar = sizeof(T_Char) == 2 ? 3 : 4;
+
+		/**
+		 * Decodes UTF-8 and returns the number of bytes read.  Stops before
+		 * an incomplete sequence at the end of the input, which is left to
+		 * the caller.
+		 * \param p_mbs - The UTF-8 input.
+		 * \param size_mbs - The size of the input in bytes.
+		 * \param p_out - Where to write, with room for size_mbs characters.
+		 * \param size_out - Set to the number of characters written.
+		 */
+		static std::size_t decode(const char* p_mbs, std::size_t size_mbs, CharType* p_out, std::size_t& size_out);
+
+		/**
+		 * Encodes to UTF-8 and returns the number of characters read.  Stops
+		 * before a high surrogate at the end of the input, which is left to
+		 * the caller.
+		 * \param p_chs - The UTF-16 or UTF-32 input.
+		 * \param size_chs - The size of the input in characters.
+		 * \param p_out - Where to write, with room for maxBytesPerChar
+		 * bytes for each character.
+		 * \param size_out - Set to the number of bytes written.
+		 */
+		static std::size_t encode(const CharType* p_chs, std::size_t size_chs, char* p_out, std::size_t& size_out);
+
+	private:
+		/**
+		 * Copies a block of ASCII characters from the input to the output,
+		 * returning the number of characters copied, which is 0 when the
+		 * block isn't all ASCII or the input is too short.
+		 */
+		static std::size_t _decodeAsciiBlock(const unsigned char* p, std::size_t size, CharType* out);
+		static std::size_t _encodeAsciiBlock(const CharType* p, std::size_t size, char* out);
+
+		/**
+		 * Writes a code point to the output, as a surrogate pair for
+		 * UTF-16 when needed, and returns the number of units written.
+		 */
+		static std::size_t _putCodePoint(char32_t cp, CharType* out);
+		static std::size_t _putUtf8(char32_t cp, char* out);
+	};
+
+	template<typename T_Char>
+	bool Utf8Transcoder<T_Char>::isUtf8Locale() {
+		thread_local std::string cachedLocale;
+		thread_local bool cachedResult = false;
+		const char* locale = std::setlocale(LC_CTYPE, nullptr);
+		if (locale && !cachedLocale.empty() && cachedLocale == locale)
+			return cachedResult;
+		std::mbstate_t mbstate{};
+		char mbch[MB_LEN_MAX]{};
+		bool result = std::c32rtomb(mbch, U'\u00e9', &mbstate) == 2
+			&& static_cast<unsigned char>(mbch[0]) == 0xC3
+			&& static_cast<unsigned char>(mbch[1]) == 0xA9;
+		cachedLocale = locale ? locale : "";
+		cachedResult = result;
+		return result;
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::_decodeAsciiBlock(const unsigned char* p, std::size_t size, CharType* out) {
+#ifdef TCLAP_UTF8_SSE2
+		if (size < 16) return 0;
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		if (_mm_movemask_epi8(v)) return 0;
+		const __m128i zero = _mm_setzero_si128();
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		if constexpr (sizeof(CharType) == 2) {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), lo);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), hi);
+		} else {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+		}
+		return 16;
+#else
+		if (size < 8) return 0;
+		std::uint64_t word;
+		std::memcpy(&word, p, sizeof(word));
+		if (word & 0x8080808080808080ull) return 0;
+		for (std::size_t i = 0; i < 8; i++) out[i] = static_cast<CharType>(p[i]);
+		return 8;
+#endif
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::_encodeAsciiBlock(const CharType* p, std::size_t size, char* out) {
+#ifdef TCLAP_UTF8_SSE2
+		if (size < 16) return 0;
+		const __m128i zero = _mm_setzero_si128();
+		__m128i packed;
+		if constexpr (sizeof(CharType) == 2) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+			__m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<short>(0xFF80)));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) return 0;
+			packed = _mm_packus_epi16(a, b);
+		} else {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+			__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+			__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12));
+			__m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), _mm_set1_epi32(~0x7F));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) return 0;
+			packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed);
+		return 16;
+#else
+		if (size < 8) return 0;
+		std::uint32_t high = 0;
+		for (std::size_t i = 0; i < 8; i++) high |= static_cast<std::uint32_t>(p[i]);
+		if (high & ~0x7Fu) return 0;
+		for (std::size_t i = 0; i < 8; i++) out[i] = static_cast<char>(p[i]);
+		return 8;
+#endif
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::_putCodePoint(char32_t cp, CharType* out) {
+		if constexpr (sizeof(CharType) == 2) {
+			if (cp >= 0x10000) {
+				cp -= 0x10000;
+				out[0] = static_cast<CharType>(0xD800 + (cp >> 10));
+				out[1] = static_cast<CharType>(0xDC00 + (cp & 0x3FF));
+				return 2;
+			}
+		}
+		out[0] = static_cast<CharType>(cp);
+		return 1;
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::_putUtf8(char32_t cp, char* out) {
+		if (cp < 0x80) {
+			out[0] = static_cast<char>(cp);
+			return 1;
+		}
+		if (cp < 0x800) {
+			out[0] = static_cast<char>(0xC0 | (cp >> 6));
+			out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+			return 2;
+		}
+		if (cp < 0x10000) {
+			out[0] = static_cast<char>(0xE0 | (cp >> 12));
+			out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+			return 3;
+		}
+		out[0] = static_cast<char>(0xF0 | (cp >> 18));
+		out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+		out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+		return 4;
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::decode(const char* p_mbs, std::size_t size_mbs, CharType* p_out, std::size_t& size_out) {
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(p_mbs);
+		std::size_t n = 0;
+		std::size_t i = 0;
+		while (i < size_mbs) {
+			if (std::size_t copied = _decodeAsciiBlock(p + i, size_mbs - i, p_out + n)) {
+				i += copied;
+				n += copied;
+				continue;
+			}
+			unsigned char b0 = p[i];
+			if (b0 < 0x80) {
+				p_out[n++] = static_cast<CharType>(b0);
+				i++;
+				continue;
+			}
+			// The length of the sequence and the range of its second byte,
+			// which rules out overlong forms, surrogates and code points
+			// above U+10FFFF.
+			std::size_t len = 0;
+			unsigned char lo = 0x80, hi = 0xBF;
+			if (b0 >= 0xC2 && b0 <= 0xDF) len = 2;
+			else if (b0 >= 0xE0 && b0 <= 0xEF) {
+				len = 3;
+				if (b0 == 0xE0) lo = 0xA0;
+				else if (b0 == 0xED) hi = 0x9F;
+			} else if (b0 >= 0xF0 && b0 <= 0xF4) {
+				len = 4;
+				if (b0 == 0xF0) lo = 0x90;
+				else if (b0 == 0xF4) hi = 0x8F;
+			}
+			bool valid = len != 0;
+			std::size_t k = 1;
+			for (; valid && k < len && i + k < size_mbs; k++) {
+				unsigned char b = p[i + k];
+				valid = k == 1 ? (b >= lo && b <= hi) : (b >= 0x80 && b <= 0xBF);
+			}
+			if (valid && k < len) {
+				// Incomplete at the end of the input.
+				break;
+			}
+			if (!valid) {
+				p_out[n++] = static_cast<CharType>(0xFFFD);
+				i++;
+				continue;
+			}
+			char32_t cp = b0 & (0x7F >> len);
+			for (k = 1; k < len; k++)
+				cp = (cp << 6) | (p[i + k] & 0x3F);
+			n += _putCodePoint(cp, p_out + n);
+			i += len;
+		}
+		size_out = n;
+		return i;
+	}
+
+	template<typename T_Char>
+	std::size_t Utf8Transcoder<T_Char>::encode(const CharType* p_chs, std::size_t size_chs, char* p_out, std::size_t& size_out) {
+		std::size_t n = 0;
+		std::size_t i = 0;
+		while (i < size_chs) {
+			if (std::size_t copied = _encodeAsciiBlock(p_chs + i, size_chs - i, p_out + n)) {
+				i += copied;
+				n += copied;
+				continue;
+			}
+			char32_t cp = static_cast<char32_t>(p_chs[i]);
+			std::size_t read = 1;
+			if (cp >= 0xD800 && cp <= 0xDBFF && sizeof(CharType) == 2) {
+				if (i + 1 == size_chs) {
+					// The low surrogate may come in the next call.
+					break;
+				}
+				char32_t low = static_cast<char32_t>(p_chs[i + 1]);
+				if (low >= 0xDC00 && low <= 0xDFFF) {
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+					read = 2;
+				}
+			}
+			if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+				cp = 0xFFFD;
+			n += _putUtf8(cp, p_out + n);
+			i += read;
+		}
+		size_out = n;
+		return i;
+	}
+
+} //namespace TCLAP
+
+#endif
@@ -58,6 +58,7 @@ namespace TCLAP {
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringViewType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename Arg<T_Char, T_CharTraits, T_Alloc>::DescriptionType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgType;
 		using typename Arg<T_Char, T_CharTraits, T_Alloc>::ArgListType;
@@ -125,7 +126,7 @@ namespace TCLAP {
 		 */
 		ValueArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			const StringType& typeDesc,
@@ -159,7 +160,7 @@ namespace TCLAP {
 		 */
 		ValueArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			const StringType& typeDesc,
@@ -191,7 +192,7 @@ namespace TCLAP {
 		 */
 		ValueArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			ConstraintType* constraint,
@@ -222,7 +223,7 @@ namespace TCLAP {
 		 */
 		ValueArg(const StringType& flag,
 			const StringType& name,
-			const StringType& desc,
+			const DescriptionType& desc,
 			bool req,
 			T value,
 			ConstraintType* constraint,
@@ -333,7 +334,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	ValueArg<T, T_Char, T_CharTraits, T_Alloc>::ValueArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		const StringType& typeDesc,
@@ -349,7 +350,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	ValueArg<T, T_Char, T_CharTraits, T_Alloc>::ValueArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		const StringType& typeDesc,
@@ -367,7 +368,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	ValueArg<T, T_Char, T_CharTraits, T_Alloc>::ValueArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		ConstraintType* constraint,
@@ -383,7 +384,7 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	ValueArg<T, T_Char, T_CharTraits, T_Alloc>::ValueArg(const StringType& flag,
 		const StringType& name,
-		const StringType& desc,
+		const DescriptionType& desc,
 		bool req,
 		T val,
 		ConstraintType* constraint,
@@ -463,12 +464,16 @@ namespace TCLAP {
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
 	void ValueArg<T, T_Char, T_CharTraits, T_Alloc>::_extractValue(const StringType& val) {
 		try {
+			TCLAP_PARSE_STATS_TIME(extractionNs);
+			TCLAP_PARSE_STATS_COUNT(conversions, 1);
 			ExtractValue(_value, val, typename ArgTraits<T>::ValueCategory());
 		} catch (ArgParseException<T_Char, T_CharTraits, T_Alloc>& e) {
 			throw ArgParseException<T_Char, T_CharTraits, T_Alloc>(e.error(), toString());
 		}
 
-		if (_constraint)
+		if (_constraint) {
+			TCLAP_PARSE_STATS_TIME(validationNs);
+			TCLAP_PARSE_STATS_COUNT(constraintChecks, 1);
 			if (!_constraint->check(_value))
 				throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(
 					StringConvertType::fromConstBasicCharString("Value \'")
@@ -477,6 +482,9 @@ namespace TCLAP {
 					+ _constraint->description(),
 					toString()
 					));
+		}
+
+		ParseEventSink<T_Char, T_CharTraits, T_Alloc>::valueConverted(*this, val);
 	}
 
 	template<class T, typename T_Char, typename T_CharTraits, typename T_Alloc>
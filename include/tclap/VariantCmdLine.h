@@ -0,0 +1,241 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  VariantCmdLine.h
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+
+#ifndef TCLAP_VARIANT_CMDLINE_H
+#define TCLAP_VARIANT_CMDLINE_H
+
+#include <cstddef>
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+namespace TCLAP {
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	class VariantCmdLine;
+
+	/**
+	 * A CmdLine that dispatches to the built-in kinds of Args without
+	 * virtual calls.  Before parsing, each added Arg whose dynamic type
+	 * is exactly SwitchArg, MultiSwitchArg, HelpArg, or a ValueArg, MultiArg,
+	 * UnlabeledValueArg or UnlabeledMultiArg of a string or a standard
+	 * arithmetic type is stored in a std::variant of pointers to those
+	 * types.  Each token is then offered to the Args through std::visit
+	 * with a qualified call to processArg, which the compiler can inline.
+	 * The matched Arg is checked against the xor lists the same way,
+	 * with qualified calls to isRequired and allowMore.  All other Args,
+	 * including classes derived from the built-in kinds, are still called
+	 * virtually.
+	 *
+	 * The calls that processArg makes on its own Arg, such as argMatches,
+	 * stay virtual, since the same processArg also serves classes that
+	 * derive from a built-in kind and override them.  So do the calls
+	 * outside the parsing loop, such as isRequired when an Arg is added
+	 * and when the missing Args are reported.
+	 *
+	 * This lives in its own header so that only programs that use it pay
+	 * for instantiating every built-in kind.
+	 */
+	template<typename T_Char = char, typename T_CharTraits = std::char_traits<T_Char>, typename T_Alloc = std::allocator<T_Char>>
+	class VariantCmdLine : public CmdLine<T_Char, T_CharTraits, T_Alloc> {
+	public:
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::AllocatorType;
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::CharType;
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::StringConvertType;
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::StringType;
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::StringVectorType;
+		using typename CmdLine<T_Char, T_CharTraits, T_Alloc>::ArgType;
+		using CmdLineType = CmdLine<T_Char, T_CharTraits, T_Alloc>;
+		using SwitchArgType = SwitchArg<T_Char, T_CharTraits, T_Alloc>;
+		using MultiSwitchArgType = MultiSwitchArg<T_Char, T_CharTraits, T_Alloc>;
+		using HelpArgType = HelpArg<T_Char, T_CharTraits, T_Alloc>;
+		template<typename T>
+		using ValueArgType = ValueArg<T, T_Char, T_CharTraits, T_Alloc>;
+		template<typename T>
+		using MultiArgType = MultiArg<T, T_Char, T_CharTraits, T_Alloc>;
+		template<typename T>
+		using UnlabeledValueArgType = UnlabeledValueArg<T, T_Char, T_CharTraits, T_Alloc>;
+		template<typename T>
+		using UnlabeledMultiArgType = UnlabeledMultiArg<T, T_Char, T_CharTraits, T_Alloc>;
+		using CmdLineType::getAlloc;
+
+	private:
+		template<typename... T_Values>
+		struct ArgVariantOf {
+			using type = std::variant<ArgType*, SwitchArgType*, MultiSwitchArgType*, HelpArgType*,
+				ValueArgType<T_Values>*..., MultiArgType<T_Values>*...,
+				UnlabeledValueArgType<T_Values>*..., UnlabeledMultiArgType<T_Values>*...>;
+		};
+
+	public:
+		/**
+		 * A pointer to an Arg of one of the built-in kinds, or to any
+		 * other Arg as the first alternative.
+		 */
+		using ArgVariantType = typename ArgVariantOf<StringType,
+			int, long, long long, unsigned int, unsigned long, unsigned long long,
+			float, double>::type;
+		using ArgVariantVectorType = std::vector<ArgVariantType, typename std::allocator_traits<AllocatorType>::template rebind_alloc<ArgVariantType>>;
+
+		/**
+		 * Command line constructor.  See CmdLine.
+		 */
+		VariantCmdLine(const StringType& message,
+			const CharType delimiter = StringConvertType::fromConstBasicChar(' '),
+			const StringType& version = StringConvertType::fromConstBasicCharString("none"),
+			bool helpAndVersion = true,
+			const AllocatorType& alloc = AllocatorType());
+
+		using CmdLineType::add;
+
+		/**
+		 * Adds an argument to the list of arguments to be parsed.
+		 * \param a - Argument to be added.
+		 */
+		virtual void add(ArgType* a) override;
+
+		/**
+		 * Returns the variant of a, which holds the most derived built-in
+		 * kind of a, or a itself if its dynamic type is not a built-in
+		 * kind.
+		 * \param a - The Arg.
+		 */
+		static ArgVariantType toVariant(ArgType* a);
+
+	protected:
+		virtual ArgType* _matchArg(std::size_t& idx_arg, StringVectorType& args) override;
+
+		virtual std::size_t _checkArg(ArgType* arg) override;
+
+	private:
+		template<std::size_t... I>
+		static ArgVariantType _toVariant(ArgType* a, std::index_sequence<I...>);
+
+		/**
+		 * The Args of _argList, in the same order.  Rebuilt on the first
+		 * match after an Arg was added, when every Arg is fully
+		 * constructed and its dynamic type is final.
+		 */
+		ArgVariantVectorType _argVariants;
+
+		bool _argVariantsStale;
+
+		/**
+		 * The variant of the Arg last returned by _matchArg.
+		 */
+		const ArgVariantType* _matched;
+	};
+
+	//////////////////////////////////////////////////////////////////////
+	//BEGIN VariantCmdLine.cpp
+	//////////////////////////////////////////////////////////////////////
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::VariantCmdLine(const StringType& m,
+		CharType delim,
+		const StringType& v,
+		bool help,
+		const AllocatorType& alloc)
+		: CmdLineType(m, delim, v, help, alloc),
+		_argVariants(alloc),
+		_argVariantsStale(true),
+		_matched(nullptr) {
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline void VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::add(ArgType* a) {
+		CmdLineType::add(a);
+		_argVariantsStale = true;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::toVariant(ArgType* a) -> ArgVariantType {
+		return _toVariant(a, std::make_index_sequence<std::variant_size_v<ArgVariantType>>());
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	template<std::size_t... I>
+	inline auto VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::_toVariant(ArgType* a, std::index_sequence<I...>) -> ArgVariantType {
+		ArgVariantType v(std::in_place_index<0>, a);
+		const std::type_info& type = typeid(*a);
+		// Only an exact match is safe, since a derived class may
+		// override processArg.
+		(void)((I != 0 && type == typeid(std::remove_pointer_t<std::variant_alternative_t<I, ArgVariantType>>)
+			&& (v.template emplace<I>(static_cast<std::variant_alternative_t<I, ArgVariantType>>(a)), true)) || ...);
+		return v;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline auto VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::_matchArg(std::size_t& idx_arg, StringVectorType& args) -> ArgType* {
+		if (_argVariantsStale || _argVariants.size() != this->_argList.size()) {
+			_argVariants.clear();
+			_argVariants.reserve(this->_argList.size());
+			for (ArgType* const& arg : this->_argList) _argVariants.push_back(toVariant(arg));
+			_argVariantsStale = false;
+		}
+
+		_matched = nullptr;
+		for (const ArgVariantType& v : _argVariants) {
+			TCLAP_PARSE_STATS_COUNT(processArgCalls, 1);
+			ArgType* matched = std::visit([&](auto* arg) -> ArgType* {
+				using ConcreteType = std::remove_pointer_t<decltype(arg)>;
+				if constexpr (std::is_same_v<ConcreteType, ArgType>)
+					return arg->processArg(idx_arg, args) ? arg : nullptr;
+				else
+					return arg->ConcreteType::processArg(idx_arg, args) ? arg : nullptr;
+			}, v);
+			if (matched) {
+				_matched = &v;
+				return matched;
+			}
+		}
+		return nullptr;
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	inline std::size_t VariantCmdLine<T_Char, T_CharTraits, T_Alloc>::_checkArg(ArgType* a) {
+		if (!_matched)
+			return CmdLineType::_checkArg(a);
+
+		return std::visit([&](auto* arg) -> std::size_t {
+			using ConcreteType = std::remove_pointer_t<decltype(arg)>;
+			if constexpr (std::is_same_v<ConcreteType, ArgType>)
+				return this->_xorHandler.check(arg);
+			else
+				return this->_xorHandler.check(arg,
+					[arg]() { return arg->ConcreteType::isRequired(); },
+					[arg]() { return arg->ConcreteType::allowMore(); });
+		}, *_matched);
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	//END VariantCmdLine.cpp
+	//////////////////////////////////////////////////////////////////////
+
+} //namespace TCLAP
+
+#endif
@@ -30,6 +30,7 @@
 #include <vector>
 #include <algorithm>
 #include <iostream>
+#include <unordered_map>
 
 #include <tclap/StringConvert.h>
 #include <tclap/UseAllocatorBase.h>
@@ -71,7 +72,7 @@ namespace TCLAP {
 		/**
 		 * Constructor.  Does nothing.
 		 */
-		XorHandler(const AllocatorType& alloc = AllocatorType()) : UseAllocatorBase<T_Alloc>(alloc), _orList(ArgVectorVectorType()) {}
+		XorHandler(const AllocatorType& alloc = AllocatorType()) : UseAllocatorBase<T_Alloc>(alloc), _orList(ArgVectorVectorType()), _orIndex() {}
 
 		/**
 		 * Add a list of Arg*'s that will be xor'd together.
@@ -88,6 +89,18 @@ namespace TCLAP {
 		 */
 		std::size_t check(const ArgType* a);
 
+		/**
+		 * Like check(a), but asks isRequired() and allowMore() instead of
+		 * calling Arg::isRequired and Arg::allowMore on a, so that a
+		 * caller that knows the dynamic type of a can avoid the virtual
+		 * calls.
+		 * \param a - The Arg to be checked.
+		 * \param isRequired - Returns a->isRequired().
+		 * \param allowMore - Returns a->allowMore().
+		 */
+		template<typename T_IsRequired, typename T_AllowMore>
+		std::size_t check(const ArgType* a, T_IsRequired&& isRequired, T_AllowMore&& allowMore);
+
 		/**
 		 * Returns the XOR specific short usage.
 		 */
@@ -104,7 +117,7 @@ namespace TCLAP {
 		 * lists.
 		 * \param a - The Arg to be checked.
 		 */
-		bool contains(const ArgType* a);
+		bool contains(const ArgType* a) const;
 
 		const ArgVectorVectorType& getXorList() const;
 
@@ -113,6 +126,14 @@ namespace TCLAP {
 		 * The list of of lists of Arg's to be or'd together.
 		 */
 		ArgVectorVectorType _orList;
+
+		using OrIndexType = std::unordered_map<const ArgType*, std::size_t, std::hash<const ArgType*>, std::equal_to<const ArgType*>, typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::pair<const ArgType* const, std::size_t>>>;
+
+		/**
+		 * The index in _orList of the first list that holds each Arg, so
+		 * that check() and contains() don't search every list.
+		 */
+		OrIndexType _orIndex;
 	};
 
 
@@ -122,51 +143,55 @@ namespace TCLAP {
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void XorHandler<T_Char, T_CharTraits, T_Alloc>::add(const ArgVectorType& ors) {
 		_orList.push_back(ors);
+		for (const ArgType* const& arg : ors)
+			_orIndex.emplace(arg, _orList.size() - 1);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline std::size_t XorHandler<T_Char, T_CharTraits, T_Alloc>::check(const ArgType* a) {
-		// iterate over each XOR list
-		for (const ArgVectorType& xorList : _orList) {
-			// if the XOR list contains the arg..
-			ArgVectorIteratorType ait = std::find(xorList.begin(), xorList.end(), a);
-			if (ait != xorList.end()) {
-				// first check to see if a mutually exclusive switch
-				// has not already been set
-				for (const ArgType* const& arg : xorList)
-					if (a != arg && arg->isSet())
-						throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(
-							StringConvertType::fromConstBasicCharString("Mutually exclusive argument already set!"),
-							arg->toString()
-							));
-
-				// go through and set each arg that is not a
-				for (ArgType* const& arg : xorList)
-					if (a != arg)
-						arg->xorSet();
-
-				// return the number of required args that have now been set
-				if ((*ait)->allowMore())
-					return 0;
-				else
-					return xorList.size();
-			}
+		return check(a,
+			[a]() { return a->isRequired(); },
+			[a]() { return const_cast<ArgType*>(a)->allowMore(); });
+	}
+
+	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
+	template<typename T_IsRequired, typename T_AllowMore>
+	inline std::size_t XorHandler<T_Char, T_CharTraits, T_Alloc>::check(const ArgType* a, T_IsRequired&& isRequired, T_AllowMore&& allowMore) {
+		// if an XOR list contains the arg..
+		typename OrIndexType::const_iterator found = _orIndex.find(a);
+		if (found != _orIndex.end()) {
+			const ArgVectorType& xorList = _orList[found->second];
+
+			// first check to see if a mutually exclusive switch
+			// has not already been set
+			for (const ArgType* const& arg : xorList)
+				if (a != arg && arg->isSet())
+					throw(CmdLineParseException<T_Char, T_CharTraits, T_Alloc>(
+						StringConvertType::fromConstBasicCharString("Mutually exclusive argument already set!"),
+						arg->toString()
+						));
+
+			// go through and set each arg that is not a
+			for (ArgType* const& arg : xorList)
+				if (a != arg)
+					arg->xorSet();
+
+			// return the number of required args that have now been set
+			if (allowMore())
+				return 0;
+			else
+				return xorList.size();
 		}
 
-		if (a->isRequired())
+		if (isRequired())
 			return 1;
 		else
 			return 0;
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
-	inline bool XorHandler<T_Char, T_CharTraits, T_Alloc>::contains(const ArgType* a) {
-		for (ArgVectorType& xorList : _orList)
-			for (const ArgType* const& arg : xorList)
-				if (a == arg)
-					return true;
-
-		return false;
+	inline bool XorHandler<T_Char, T_CharTraits, T_Alloc>::contains(const ArgType* a) const {
+		return _orIndex.find(a) != _orIndex.end();
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
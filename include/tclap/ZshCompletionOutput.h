@@ -31,11 +31,11 @@
 #include <string>
 #include <vector>
 #include <list>
-#include <sstream>
 #include <iostream>
 #include <map>
 
 #include <tclap/StringConvert.h>
+#include <tclap/OutputBuffer.h>
 #include <tclap/CmdLineInterface.h>
 #include <tclap/CmdLineOutput.h>
 #include <tclap/XorHandler.h>
@@ -71,6 +71,7 @@ namespace TCLAP {
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineInterfaceType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::CmdLineOutputType;
 		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::XorHandlerType;
+		using typename CmdLineOutput<T_Char, T_CharTraits, T_Alloc>::OutputBufferType;
 		using UseAllocatorBase<T_Alloc>::getAlloc;
 		using UseAllocatorBase<T_Alloc>::rebindAlloc;
 
@@ -110,13 +111,19 @@ namespace TCLAP {
 		std::map<StringType, StringType> common;
 		CharType theDelimiter;
 		ConvertedStdioStreams<T_Char, T_CharTraits> convertedStdioStreams;
+
+		/**
+		 * The document being rendered, written to stdout at once.
+		 */
+		OutputBufferType _buffer;
 	};
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::ZshCompletionOutput(const AllocatorType& alloc)
 		: CmdLineOutput<T_Char, T_CharTraits, T_Alloc>(alloc),
 		common(std::map<StringType, StringType>()),
-		theDelimiter(StringConvertType::fromConstBasicChar('=')) {
+		theDelimiter(StringConvertType::fromConstBasicChar('=')),
+		_buffer(alloc) {
 		common[StringConvertType::fromConstBasicCharString("host")] = StringConvertType::fromConstBasicCharString("_hosts");
 		common[StringConvertType::fromConstBasicCharString("hostname")] = StringConvertType::fromConstBasicCharString("_hosts");
 		common[StringConvertType::fromConstBasicCharString("file")] = StringConvertType::fromConstBasicCharString("_files");
@@ -130,22 +137,21 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::version(CmdLineInterfaceType& _cmd) {
-		OstreamType& os = convertedStdioStreams.getCout();
-		os << _cmd.getVersion() << std::endl;
+		_buffer << _cmd.getVersion() << std::endl;
+		_buffer.writeTo(convertedStdioStreams.getCout());
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::usage(CmdLineInterfaceType& _cmd) {
-		OstreamType& os = convertedStdioStreams.getCout();
-		ArgListType argList = _cmd.getArgList();
+		OutputBufferType& os = _buffer;
+		const ArgListType& argList = _cmd.getArgList();
 		StringType progName = _cmd.getProgramName();
-		StringType xversion = _cmd.getVersion();
 		theDelimiter = _cmd.getDelimiter();
 		basename(progName);
 
-		os << StringConvertType::fromConstBasicCharString("#compdef ") << progName << std::endl << std::endl <<
-			StringConvertType::fromConstBasicCharString("# ") << progName << StringConvertType::fromConstBasicCharString(" version ") << _cmd.getVersion() << std::endl << std::endl <<
-			StringConvertType::fromConstBasicCharString("_arguments -s -S");
+		os << StringConvertType::template constBasicString<"#compdef ">() << progName << std::endl << std::endl <<
+			StringConvertType::template constBasicString<"# ">() << progName << StringConvertType::template constBasicString<" version ">() << _cmd.getVersion() << std::endl << std::endl <<
+			StringConvertType::template constBasicString<"_arguments -s -S">();
 
 		for (const ArgType* const& arg : argList) {
 			if (arg->shortID().at(0) == StringConvertType::fromConstBasicChar('<'))
@@ -155,6 +161,7 @@ namespace TCLAP {
 		}
 
 		os << std::endl;
+		_buffer.writeTo(convertedStdioStreams.getCout());
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
@@ -165,19 +172,18 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::quoteSpecialChars(StringType& s) {
-		size_t idx = s.find_last_of(StringConvertType::fromConstBasicChar(':'));
-		while (idx != StringType::npos) {
-			s.insert(idx, 1, StringConvertType::fromConstBasicChar('\\'));
-			idx = s.find_last_of(StringConvertType::fromConstBasicChar(':'), idx);
-		}
-		idx = s.find_last_of(StringConvertType::fromConstBasicChar('\''));
-		while (idx != StringType::npos) {
-			s.insert(idx, StringConvertType::fromConstBasicCharString("'\\'"));
-			if (idx == 0)
-				idx = StringType::npos;
-			else
-				idx = s.find_last_of(StringConvertType::fromConstBasicChar('\''), --idx);
+		// one pass into a new string, since inserting in place is
+		// quadratic in the number of special chars
+		StringType quoted(s.get_allocator());
+		quoted.reserve(s.size());
+		for (const CharType& ch : s) {
+			if (ch == StringConvertType::fromConstBasicChar(':'))
+				quoted += StringConvertType::fromConstBasicChar('\\');
+			else if (ch == StringConvertType::fromConstBasicChar('\''))
+				quoted += StringConvertType::fromConstBasicCharString("'\\'");
+			quoted += ch;
 		}
+		s = std::move(quoted);
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
@@ -190,10 +196,10 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::printArg(const ArgType* a) {
-		OstreamType& os = convertedStdioStreams.getCout();
+		OutputBufferType& os = _buffer;
 		static std::size_t count = 1;
 
-		os << StringConvertType::fromConstBasicCharString(" \\") << std::endl << StringConvertType::fromConstBasicCharString("  \'");
+		os << StringConvertType::template constBasicString<" \\">() << std::endl << StringConvertType::template constBasicString<"  \'">();
 		if (a->acceptsMultipleValues())
 			os << StringConvertType::fromConstBasicChar('*');
 		else
@@ -207,16 +213,17 @@ namespace TCLAP {
 		if (compArg != common.end()) {
 			os << compArg->second;
 		} else {
-			os << StringConvertType::fromConstBasicCharString("_guard \"^-*\" ") << a->getName();
+			os << StringConvertType::template constBasicString<"_guard \"^-*\" ">() << a->getName();
 		}
 		os << StringConvertType::fromConstBasicChar('\'');
 	}
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline void ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::printOption(const ArgType* a, StringType mutex) {
-		OstreamType& os = convertedStdioStreams.getCout();
+		OutputBufferType& os = _buffer;
 		StringType flag = a->flagStartChar() + a->getFlag();
-		StringType name = a->nameStartString() + a->getName();
+		StringType name(a->nameStartString());
+		name += a->getName();
 		StringType desc = a->getDescription();
 
 		// remove full stop and capitalization from description as
@@ -235,15 +242,15 @@ namespace TCLAP {
 			desc.replace(0, 1, 1, tolower(desc.at(0)));
 		}
 
-		os << StringConvertType::fromConstBasicCharString(" \\") << std::endl << StringConvertType::fromConstBasicCharString("  \'") << mutex;
+		os << StringConvertType::template constBasicString<" \\">() << std::endl << StringConvertType::template constBasicString<"  \'">() << mutex;
 
 		if (a->getFlag().empty()) {
 			os << name;
 		} else {
-			os << StringConvertType::fromConstBasicCharString("\'{") << flag << StringConvertType::fromConstBasicChar(',') << name << StringConvertType::fromConstBasicCharString("}\'");
+			os << StringConvertType::template constBasicString<"\'{">() << flag << StringConvertType::fromConstBasicChar(',') << name << StringConvertType::template constBasicString<"}\'">();
 		}
 		if (theDelimiter == StringConvertType::fromConstBasicChar('=') && a->isValueRequired())
-			os << StringConvertType::fromConstBasicCharString("=-");
+			os << StringConvertType::template constBasicString<"=-">();
 		quoteSpecialChars(desc);
 		os << StringConvertType::fromConstBasicChar('[') << desc << StringConvertType::fromConstBasicChar(']');
 
@@ -269,7 +276,7 @@ namespace TCLAP {
 					arg.replace(p, 1, 1, StringConvertType::fromConstBasicChar(' '));
 				} while ((p = arg.find_first_of(StringConvertType::fromConstBasicChar('|'), p)) != StringType::npos);
 				quoteSpecialChars(arg);
-				os << StringConvertType::fromConstBasicCharString(": :(") << arg << StringConvertType::fromConstBasicChar(')');
+				os << StringConvertType::template constBasicString<": :(">() << arg << StringConvertType::fromConstBasicChar(')');
 			} else {
 				os << StringConvertType::fromConstBasicChar(':') << arg;
 				typename std::map<StringType, StringType>::iterator compArg = common.find(arg);
@@ -284,14 +291,14 @@ namespace TCLAP {
 
 	template<typename T_Char, typename T_CharTraits, typename T_Alloc>
 	inline auto ZshCompletionOutput<T_Char, T_CharTraits, T_Alloc>::getMutexList(CmdLineInterfaceType& _cmd, const ArgType* a) -> StringType {
-		XorHandler xorHandler = _cmd.getXorHandler();
-		ArgVectorVectorType xorList = xorHandler.getXorList();
+		const XorHandlerType& xorHandler = _cmd.getXorHandler();
+		const ArgVectorVectorType& xorList = xorHandler.getXorList();
 
 		if (a->getName() == StringConvertType::fromConstBasicCharString("help") || a->getName() == StringConvertType::fromConstBasicCharString("version")) {
 			return StringConvertType::fromConstBasicCharString("(-)");
 		}
 
-		std::basic_ostringstream<T_Char, T_CharTraits, T_Alloc> list;
+		OutputBufferType list(getAlloc());
 		if (a->acceptsMultipleValues()) {
 			list << StringConvertType::fromConstBasicChar('*');
 		}
@@ -315,17 +322,17 @@ namespace TCLAP {
 							list << (*iu)->nameStartString() << (*iu)->getName();
 					}
 					list << StringConvertType::fromConstBasicChar(')');
-					return list.str();
+					return list.release();
 				}
 		}
 
 		// wasn't found in xor list
 		if (!a->getFlag().empty()) {
-			list << StringConvertType::fromConstBasicCharString("(") << a->flagStartChar() << a->getFlag() << StringConvertType::fromConstBasicChar(' ') <<
+			list << StringConvertType::template constBasicString<"(">() << a->flagStartChar() << a->getFlag() << StringConvertType::fromConstBasicChar(' ') <<
 				a->nameStartString() << a->getName() << StringConvertType::fromConstBasicChar(')');
 		}
 
-		return list.str();
+		return list.release();
 	}
 
 } //namespace TCLAP
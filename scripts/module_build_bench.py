@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+
+# See the file COPYING in the top directory of this distribution for
+# more information.
+#
+# THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+
+"""Compares the build times of the examples with headers and with the
+tclap module (src/tclap.cppm).
+
+The module is compiled once, then every examples/test*.cpp is compiled
+twice: as is, and with its tclap includes replaced by "import tclap;".
+Examples that set configuration macros, which don't reach a module, are
+skipped.  Any build that fails is an error, reported with the compiler
+output.  The module needs GCC 14 or Clang 16 or later.
+
+  scripts/module_build_bench.py [--cxx g++|clang++] [--flags ...] [--csv]
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+TOP = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_RE = re.compile(r'^\s*#\s*include\s*[<"]tclap/[^>"]+[>"]')
+CONFIG_RE = re.compile(r'^\s*#\s*define\s+TCLAP_')
+
+
+def timed(cmd, cwd):
+    """Runs cmd and returns the seconds it took, or exits with its output
+    if it failed."""
+    start = time.perf_counter()
+    result = subprocess.run(cmd, cwd=cwd, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT)
+    elapsed = time.perf_counter() - start
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout.decode(errors='replace'))
+        sys.exit('error: failed: ' + ' '.join(cmd))
+    return elapsed
+
+
+def check_compiler(cxx):
+    """Exits unless cxx can import the module.  GCC before 14 doesn't
+    export the using-declarations of src/tclap.cppm."""
+    version = subprocess.run([cxx, '-dumpversion'], stdout=subprocess.PIPE,
+                             universal_newlines=True).stdout.strip()
+    major = int(version.split('.')[0]) if version[:1].isdigit() else 0
+    needed = 16 if 'clang' in os.path.basename(cxx) else 14
+    if major < needed:
+        sys.exit('error: the tclap module needs %s %d or later, not %s' % (
+            'Clang' if needed == 16 else 'GCC', needed, version or cxx))
+
+
+def module_flags(cxx, builddir):
+    """Returns the commands to build the module and the flags to import
+    it, for GCC or Clang."""
+    source = os.path.join(TOP, 'src', 'tclap.cppm')
+    if 'clang' in os.path.basename(cxx):
+        pcm = os.path.join(builddir, 'tclap.pcm')
+        build = [['--precompile', '-x', 'c++-module', source, '-o', pcm],
+                 [pcm, '-c', '-o', os.path.join(builddir, 'tclap.o')]]
+        return build, ['-fmodule-file=tclap=' + pcm]
+    build = [['-fmodules-ts', '-x', 'c++', '-c', source,
+              '-o', os.path.join(builddir, 'tclap.o')]]
+    return build, ['-fmodules-ts']
+
+
+def to_module(path):
+    """Returns the source of an example importing the module, or None if
+    it can't use it."""
+    with open(path) as f:
+        lines = f.readlines()
+    if any(CONFIG_RE.match(l) for l in lines):
+        return None
+    includes = [i for i, l in enumerate(lines) if INCLUDE_RE.match(l)]
+    if not includes:
+        return None
+    # The standard headers of the example must precede the import.
+    last = max(i for i, l in enumerate(lines) if l.lstrip().startswith('#include'))
+    for i in includes:
+        lines[i] = '\n'
+    lines.insert(last + 1, 'import tclap;\n')
+    return ''.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'g++'))
+    parser.add_argument('--flags', default='-std=c++20 -O2',
+                        help='compiler flags for both builds')
+    parser.add_argument('--csv', action='store_true',
+                        help='print one line per example as CSV')
+    args = parser.parse_args()
+    flags = args.flags.split()
+    include = ['-I' + os.path.join(TOP, 'include')]
+
+    check_compiler(args.cxx)
+
+    builddir = tempfile.mkdtemp(prefix='tclap-module-bench-')
+    try:
+        build, import_flags = module_flags(args.cxx, builddir)
+        module_time = 0.0
+        for cmd in build:
+            module_time += timed([args.cxx] + flags + include + cmd, builddir)
+
+        rows = []
+        for path in sorted(glob.glob(os.path.join(TOP, 'examples', 'test*.cpp'))):
+            name = os.path.basename(path)
+            source = to_module(path)
+            if source is None:
+                continue
+            imported = os.path.join(builddir, name)
+            with open(imported, 'w') as f:
+                f.write(source)
+            t_header = timed([args.cxx] + flags + include +
+                             ['-c', path, '-o', os.devnull], builddir)
+            t_module = timed([args.cxx] + flags + import_flags +
+                             ['-c', imported, '-o', os.devnull], builddir)
+            rows.append((name, t_header, t_module))
+
+        if args.csv:
+            print('example,header_s,module_s')
+            for name, t_header, t_module in rows:
+                print('%s,%.3f,%.3f' % (name, t_header, t_module))
+            print('tclap.cppm,,%.3f' % module_time)
+            return
+
+        total_header = sum(r[1] for r in rows)
+        total_module = sum(r[2] for r in rows)
+        print('%-14s %10s %10s' % ('example', 'header s', 'module s'))
+        for name, t_header, t_module in rows:
+            print('%-14s %10.3f %10.3f' % (name, t_header, t_module))
+        print('%-14s %10.3f %10.3f' % ('total', total_header, total_module))
+        print('%-14s %10s %10.3f' % ('+ module', '', total_module + module_time))
+        if total_header:
+            print('speedup: %.2fx (%.2fx counting the module build)' % (
+                total_header / total_module,
+                total_header / (total_module + module_time)))
+    finally:
+        shutil.rmtree(builddir)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  tclap.cppm
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/*
+ * The tclap named module, which exports the public API of the headers.
+ * Importers don't parse the headers or the standard headers they
+ * include.  Macros don't cross a module boundary, so the module always
+ * has the default configuration: TCLAP_FLAGSTARTCHAR and the other
+ * configuration macros must be set when building the module, not by
+ * the importer.  The importer also has to include the standard headers
+ * it uses itself, such as <iostream>.
+ *
+ * It needs GCC 14, Clang 16 or MSVC 19.34 or later, the compilers
+ * that CMake supports modules with.  GCC 12 builds it, but doesn't
+ * export the using-declarations below, so importers find no names in
+ * TCLAP.
+ */
+
+module;
+
+#include <tclap/CmdLine.h>
+#include <tclap/VariantCmdLine.h>
+#include <tclap/StaticCmdLine.h>
+#include <tclap/ArgTableImage.h>
+#include <tclap/ValuesConstraint.h>
+#include <tclap/DocBookOutput.h>
+#include <tclap/ZshCompletionOutput.h>
+
+export module tclap;
+
+export namespace TCLAP {
+	// Args
+	using TCLAP::Arg;
+	using TCLAP::ArgDescription;
+	using TCLAP::ArgListIterator;
+	using TCLAP::ArgVectorIterator;
+	using TCLAP::SwitchArg;
+	using TCLAP::MultiSwitchArg;
+	using TCLAP::ValueArg;
+	using TCLAP::MultiArg;
+	using TCLAP::UnlabeledValueArg;
+	using TCLAP::UnlabeledMultiArg;
+	using TCLAP::SubcommandArg;
+	using TCLAP::ArgTable;
+	using TCLAP::ArgTableImage;
+	using TCLAP::OptionalUnlabeledTracker;
+	using TCLAP::HelpArg;
+
+	// Values
+	using TCLAP::ArgTraits;
+	using TCLAP::ValueLike;
+	using TCLAP::StringLike;
+	using TCLAP::ValueLikeTrait;
+	using TCLAP::StringLikeTrait;
+	using TCLAP::ExtractValue;
+	using TCLAP::SetString;
+	using TCLAP::Constraint;
+	using TCLAP::ValuesConstraint;
+
+	// Command lines
+	using TCLAP::CmdLineInterface;
+	using TCLAP::CmdLine;
+	using TCLAP::VariantCmdLine;
+	using TCLAP::XorHandler;
+	using TCLAP::ParseStats;
+	using TCLAP::ParseEventKind;
+	using TCLAP::ParseEvent;
+	using TCLAP::ParseEventSink;
+	using TCLAP::CallbackParseEventSink;
+	using TCLAP::makeParseEventSink;
+
+	// Compile-time command lines
+	using TCLAP::StaticNameTable;
+	using TCLAP::StaticValueArg;
+	using TCLAP::StaticMultiArg;
+	using TCLAP::StaticSwitchArg;
+	using TCLAP::StaticCmdLine;
+	using TCLAP::staticValueArg;
+	using TCLAP::staticMultiArg;
+	using TCLAP::staticSwitchArg;
+	using TCLAP::makeStaticCmdLine;
+
+	// Output
+	using TCLAP::CmdLineOutput;
+	using TCLAP::StdOutput;
+	using TCLAP::DocBookOutput;
+	using TCLAP::ZshCompletionOutput;
+	using TCLAP::OutputBuffer;
+	using TCLAP::UsageCache;
+	using TCLAP::TerminalWidth;
+
+	// Visitors
+	using TCLAP::Visitor;
+	using TCLAP::VisitorListIterator;
+	using TCLAP::HelpVisitor;
+	using TCLAP::VersionVisitor;
+	using TCLAP::IgnoreRestVisitor;
+
+	// Exceptions
+	using TCLAP::ArgException;
+	using TCLAP::ArgParseException;
+	using TCLAP::CmdLineParseException;
+	using TCLAP::SpecificationException;
+	using TCLAP::ExitException;
+
+	// Strings and allocators
+	using TCLAP::UseAllocatorBase;
+	using TCLAP::StringConvert;
+	using TCLAP::BasicCharLiteral;
+	using TCLAP::Utf8Transcoder;
+	using TCLAP::FdWriter;
+	using TCLAP::ConvertedStdioStreams;
+	using TCLAP::DecodedArgv;
+	using TCLAP::StringHash;
+	using TCLAP::StringPool;
+}
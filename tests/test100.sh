@@ -0,0 +1,3 @@
+#!/bin/sh
+# success
+./simple-test.sh `basename $0 .sh` test35 -i 3 -n run -l a --level b -x -v -v -q f1 f2
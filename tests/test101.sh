@@ -0,0 +1,3 @@
+#!/bin/sh
+# failure
+./simple-test.sh `basename $0 .sh` test35 -l a -c 2 -i x
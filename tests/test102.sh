@@ -0,0 +1,3 @@
+#!/bin/sh
+# success
+./simple-test.sh `basename $0 .sh` test36 -t run -i 3 -l 1 --level 2 -x
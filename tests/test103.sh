@@ -0,0 +1,3 @@
+#!/bin/sh
+# success
+./simple-test.sh `basename $0 .sh` test36 --help
@@ -0,0 +1,3 @@
+#!/bin/sh
+# failure
+./simple-test.sh `basename $0 .sh` test37 -i 3 -m medium
@@ -0,0 +1,3 @@
+#!/bin/sh
+# success
+./simple-test.sh `basename $0 .sh` test38 -i 3 -xvv --mode fast -m slow a b
@@ -0,0 +1,3 @@
+#!/bin/sh
+# failure
+./simple-test.sh `basename $0 .sh` test38 -v -i abc
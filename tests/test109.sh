@@ -0,0 +1,3 @@
+#!/bin/sh
+# failure
+./simple-test.sh `basename $0 .sh` test39 3 x 5
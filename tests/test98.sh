@@ -0,0 +1,3 @@
+#!/bin/sh
+# success
+./simple-test.sh `basename $0 .sh` test34 -i 3 --tag hi -l 1 --level 2 -x -q
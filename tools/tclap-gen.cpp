@@ -0,0 +1,419 @@
+// -*- Mode: c++; c-basic-offset: 4; tab-width: 4; -*-
+
+/******************************************************************************
+ *
+ *  file:  tclap-gen.cpp
+ *
+ *  Copyright (c) 2026, TCLAP contributors.
+ *  All rights reserved.
+ *
+ *  See the file COPYING in the top directory of this distribution for
+ *  more information.
+ *
+ *  THE SOFTWARE IS PROVIDED _AS IS_, WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ *  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/*
+ * Generates a parser header from a declarative spec:
+ *
+ *   tclap-gen <spec> <header>
+ *
+ * The spec is made of INI style sections.  Lines starting with '#' or
+ * ';' are comments.  [parser] sets the namespace and result struct of
+ * the generated code and the message printed at the end of the usage.
+ * Each option is a [value <name>], [multi <name>] or [switch <name>]
+ * section.  The name, with '-' replaced by '_', is the member of the
+ * result struct, so it must make a C++ identifier.  A default is a C++
+ * initializer, or plain text for strings, and typeDesc defaults to the
+ * type.
+ *
+ *   [parser]
+ *   namespace = cli
+ *   struct = Options
+ *   message = Does things.
+ *
+ *   [value iterations]
+ *   flag = i
+ *   type = int
+ *   default = 10
+ *   typeDesc = count
+ *   required = false
+ *   description = Number of iterations
+ *
+ * The header holds the result struct, a constexpr StaticCmdLine, whose
+ * flag and name tables are perfect hashes computed by the compiler, the
+ * help text already wrapped, and parse() and usage() functions.  parse()
+ * throws the TCLAP exceptions; -h and --help print the usage and throw
+ * TCLAP::ExitException, unless they are the value of an option.
+ */
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+	struct Option {
+		std::string kind;
+		std::string name;
+		std::string flag;
+		std::string type;
+		std::string def;
+		std::string typeDesc;
+		std::string description;
+		bool required = false;
+		int line = 0;
+	};
+
+	struct Spec {
+		std::string ns = "cli";
+		std::string structName = "Options";
+		std::string message;
+		std::vector<Option> options;
+	};
+
+	class SpecError : public std::runtime_error {
+	public:
+		SpecError(int line, const std::string& what)
+			: std::runtime_error("line " + std::to_string(line) + ": " + what) {}
+	};
+
+	std::string trim(const std::string& s) {
+		std::string::size_type begin = s.find_first_not_of(" \t\r");
+		if (begin == std::string::npos) return std::string();
+		std::string::size_type end = s.find_last_not_of(" \t\r");
+		return s.substr(begin, end - begin + 1);
+	}
+
+	bool isIdentifier(const std::string& s) {
+		if (s.empty() || (s[0] >= '0' && s[0] <= '9')) return false;
+		for (char ch : s)
+			if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == ':'))
+				return false;
+		return true;
+	}
+
+	const std::set<std::string> keywords = {
+		"alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+		"case", "catch", "char", "char8_t", "char16_t", "char32_t", "class", "compl", "concept",
+		"const", "consteval", "constexpr", "constinit", "const_cast", "continue", "co_await",
+		"co_return", "co_yield", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+		"else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+		"if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+		"nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register",
+		"reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static",
+		"static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local",
+		"throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using",
+		"virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq"
+	};
+
+	/**
+	 * Returns the member of the result struct that holds opt, which is
+	 * its name with '-' replaced by '_'.
+	 */
+	std::string member(const Option& opt) {
+		std::string s = opt.name;
+		for (char& ch : s) if (ch == '-') ch = '_';
+		return s;
+	}
+
+	bool parseBool(int line, const std::string& s) {
+		if (s == "true" || s == "yes" || s == "1") return true;
+		if (s == "false" || s == "no" || s == "0") return false;
+		throw SpecError(line, "expected a boolean, got '" + s + "'");
+	}
+
+	Spec readSpec(std::istream& is) {
+		Spec spec;
+		std::set<std::string> flags, names, members;
+		bool inParser = false;
+		std::string text;
+		for (int line = 1; std::getline(is, text); line++) {
+			text = trim(text);
+			if (text.empty() || text[0] == '#' || text[0] == ';') continue;
+
+			if (text[0] == '[') {
+				if (text.back() != ']') throw SpecError(line, "unterminated section header");
+				std::istringstream header(text.substr(1, text.size() - 2));
+				std::string kind, name, rest;
+				header >> kind >> name >> rest;
+				inParser = kind == "parser";
+				if (inParser) {
+					if (!name.empty()) throw SpecError(line, "[parser] takes no name");
+					continue;
+				}
+				if (kind != "value" && kind != "multi" && kind != "switch")
+					throw SpecError(line, "unknown section kind '" + kind + "'");
+				if (name.empty() || !rest.empty())
+					throw SpecError(line, "expected [" + kind + " <name>]");
+				if (!names.insert(name).second)
+					throw SpecError(line, "duplicate name '" + name + "'");
+				Option opt;
+				opt.kind = kind;
+				opt.name = name;
+				opt.line = line;
+				// the name is also the member of the result struct
+				std::string m = member(opt);
+				if (name[0] == '-' || !isIdentifier(m) || m.find(':') != std::string::npos || keywords.count(m))
+					throw SpecError(line, "'" + name + "' does not make a valid member name");
+				if (!members.insert(m).second)
+					throw SpecError(line, "'" + name + "' makes the same member as another option");
+				spec.options.push_back(opt);
+				continue;
+			}
+
+			std::string::size_type eq = text.find('=');
+			if (eq == std::string::npos) throw SpecError(line, "expected key = value");
+			std::string key = trim(text.substr(0, eq));
+			std::string value = trim(text.substr(eq + 1));
+			if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+				value = value.substr(1, value.size() - 2);
+
+			if (inParser) {
+				if (key == "namespace") spec.ns = value;
+				else if (key == "struct") spec.structName = value;
+				else if (key == "message") spec.message = value;
+				else throw SpecError(line, "unknown key '" + key + "' in [parser]");
+				if (key != "message" && !isIdentifier(value))
+					throw SpecError(line, "'" + value + "' is not an identifier");
+				continue;
+			}
+
+			if (spec.options.empty()) throw SpecError(line, "key outside of a section");
+			Option& opt = spec.options.back();
+			if (key == "flag") {
+				if (value.size() != 1 || !std::isalnum(static_cast<unsigned char>(value[0])))
+					throw SpecError(line, "a flag is a single letter or digit");
+				if (!flags.insert(value).second) throw SpecError(line, "duplicate flag '" + value + "'");
+				opt.flag = value;
+			}
+			else if (key == "type" && opt.kind != "switch") opt.type = value;
+			else if (key == "default" && opt.kind == "value") opt.def = value;
+			else if (key == "typeDesc" && opt.kind != "switch") opt.typeDesc = value;
+			else if (key == "required" && opt.kind != "switch") opt.required = parseBool(line, value);
+			else if (key == "description") opt.description = value;
+			else throw SpecError(line, "unknown key '" + key + "' in [" + opt.kind + " " + opt.name + "]");
+		}
+
+		for (Option& opt : spec.options) {
+			if (opt.kind != "switch" && opt.type.empty())
+				throw SpecError(opt.line, "'" + opt.name + "' has no type");
+			if (opt.typeDesc.empty()) opt.typeDesc = opt.type;
+			if (opt.flag == "h" || opt.name == "help")
+				throw SpecError(opt.line, "-h and --help are reserved");
+		}
+		return spec;
+	}
+
+	std::string literal(const std::string& s) {
+		std::string out = "\"";
+		for (char ch : s) {
+			if (ch == '"' || ch == '\\') out += '\\';
+			if (ch == '\n') { out += "\\n"; continue; }
+			out += ch;
+		}
+		return out + "\"";
+	}
+
+	std::string cppType(const std::string& type) {
+		return type == "string" ? "std::string" : type;
+	}
+
+	/**
+	 * Wraps s to width columns the way StdOutput::spacePrint does,
+	 * indenting every line and the lines after the first by
+	 * secondLineOffset more.  Lines break after a space, ',' or '|', and
+	 * the spaces within a line are kept.
+	 */
+	std::string wrap(const std::string& s, std::size_t width, std::size_t indent, std::size_t secondLineOffset = 0) {
+		std::string out;
+		std::size_t allowedLen = width - indent;
+		for (std::size_t start = 0; start < s.size(); ) {
+			std::size_t end = s.size();
+			if (end - start > allowedLen) {
+				end = start + allowedLen;
+				std::string::size_type pos = s.substr(start, allowedLen).find_last_of(" ,|");
+				if (pos != std::string::npos) end = start + pos + 1;
+			}
+			out += std::string(indent, ' ') + s.substr(start, end - start) + "\n";
+			if (start == 0) {
+				indent += secondLineOffset;
+				allowedLen -= secondLineOffset;
+			}
+			start = end;
+			while (start < s.size() && s[start] == ' ') start++;
+		}
+		return out;
+	}
+
+	std::string id(const Option& opt, bool longForm) {
+		std::string value = opt.kind == "switch" ? "" : " <" + opt.typeDesc + ">";
+		std::string s;
+		if (!opt.flag.empty()) s = "-" + opt.flag + value;
+		if (longForm || opt.flag.empty()) s += (s.empty() ? "--" : ",  --") + opt.name + value;
+		return s;
+	}
+
+	void writeHeader(std::ostream& os, const Spec& spec, const std::string& specPath) {
+		std::string guard = "TCLAP_GENERATED_" + spec.ns + "_" + spec.structName + "_H";
+		for (char& ch : guard) ch = (ch == ':') ? '_' : static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+
+		std::string::size_type slash = specPath.find_last_of("/\\");
+		os << "// Generated by tclap-gen from " << specPath.substr(slash == std::string::npos ? 0 : slash + 1) << ".  Do not edit.\n\n"
+			<< "#ifndef " << guard << "\n#define " << guard << "\n\n"
+			<< "#include <iostream>\n#include <string>\n#include <string_view>\n#include <vector>\n\n"
+			<< "#include <tclap/StaticCmdLine.h>\n\n"
+			<< "namespace " << spec.ns << " {\n\n";
+
+		os << "\tstruct " << spec.structName << " {\n";
+		for (const Option& opt : spec.options) {
+			if (opt.kind == "switch")
+				os << "\t\tbool " << member(opt) << " = false;\n";
+			else if (opt.kind == "multi")
+				os << "\t\tstd::vector<" << cppType(opt.type) << "> " << member(opt) << ";\n";
+			else if (opt.def.empty())
+				os << "\t\t" << cppType(opt.type) << " " << member(opt) << "{};\n";
+			else
+				os << "\t\t" << cppType(opt.type) << " " << member(opt) << " = "
+					<< (opt.type == "string" ? literal(opt.def) : opt.def) << ";\n";
+		}
+		os << "\t};\n\n";
+
+		os << "\tinline constexpr auto cmdLine = TCLAP::makeStaticCmdLine(";
+		for (std::size_t i = 0; i < spec.options.size(); i++) {
+			const Option& opt = spec.options[i];
+			os << (i ? ",\n\t\t" : "\n\t\t") << "TCLAP::static"
+				<< (opt.kind == "switch" ? "Switch" : opt.kind == "multi" ? "Multi" : "Value") << "Arg("
+				<< literal(opt.flag) << ", " << literal(opt.name) << ", " << literal(opt.description) << ", ";
+			if (opt.kind != "switch") os << literal(opt.typeDesc) << ", ";
+			os << "&" << spec.structName << "::" << member(opt);
+			if (opt.kind != "switch") os << ", " << (opt.required ? "true" : "false");
+			os << ")";
+		}
+		os << ");\n\n";
+
+		std::string shortUsage;
+		for (const Option& opt : spec.options) {
+			std::string s = id(opt, false);
+			if (!opt.required) s = "[" + s + "]";
+			if (opt.kind == "multi") s += " ...";
+			shortUsage += s + " ";
+		}
+		shortUsage += "[-h]";
+
+		std::string help;
+		for (const Option& opt : spec.options) {
+			help += wrap(id(opt, true) + (opt.kind == "multi" ? "  (accepted multiple times)" : ""), 75, 3, 3);
+			help += wrap((opt.required ? "(required)  " : "") + opt.description, 75, 5) + "\n";
+		}
+		help += "   -h,  --help\n" + wrap("Displays usage information and exits.", 75, 5) + "\n";
+		if (!spec.message.empty()) help += "\n" + wrap(spec.message, 75, 3);
+
+		os << "\tinline constexpr std::string_view shortUsage = " << literal(shortUsage) << ";\n\n"
+			<< "\tinline constexpr std::string_view helpText =";
+		for (std::string::size_type begin = 0, end; begin < help.size(); begin = end + 1) {
+			end = help.find('\n', begin);
+			os << "\n\t\t" << literal(help.substr(begin, end - begin + 1));
+		}
+		os << ";\n\n";
+
+		// The program name is only known at run time, so the short usage
+		// is wrapped then, the same way as wrap() does.
+		os << "\t/**\n\t * Prints the usage to os.\n\t */\n"
+			<< "\tinline void usage(std::ostream& os, std::string_view progName) {\n"
+			<< "\t\tstd::string s = std::string(progName) + \" \" + std::string(shortUsage);\n"
+			<< "\t\tstd::size_t indent = 3, allowedLen = 75 - indent;\n"
+			<< "\t\tstd::size_t secondLineOffset = progName.size() + 1 < 75 / 2 ? progName.size() + 1 : 75 / 2;\n"
+			<< "\t\tos << \"\\nUSAGE: \\n\\n\";\n"
+			<< "\t\tfor (std::size_t start = 0; start < s.size(); ) {\n"
+			<< "\t\t\tstd::size_t end = s.size();\n"
+			<< "\t\t\tif (end - start > allowedLen) {\n"
+			<< "\t\t\t\tend = start + allowedLen;\n"
+			<< "\t\t\t\tstd::string::size_type pos = s.substr(start, allowedLen).find_last_of(\" ,|\");\n"
+			<< "\t\t\t\tif (pos != std::string::npos) end = start + pos + 1;\n"
+			<< "\t\t\t}\n"
+			<< "\t\t\tos << std::string(indent, ' ') << s.substr(start, end - start) << \"\\n\";\n"
+			<< "\t\t\tif (start == 0) {\n"
+			<< "\t\t\t\tindent += secondLineOffset;\n"
+			<< "\t\t\t\tallowedLen -= secondLineOffset;\n"
+			<< "\t\t\t}\n"
+			<< "\t\t\tstart = end;\n"
+			<< "\t\t\twhile (start < s.size() && s[start] == ' ') start++;\n"
+			<< "\t\t}\n"
+			<< "\t\tos << \"\\n\\nWhere: \\n\\n\" << helpText << std::endl;\n"
+			<< "\t}\n\n";
+
+		// The tokens that take the next one as their value, which the
+		// scan for -h and --help skips.
+		std::string takesValue;
+		for (const Option& opt : spec.options) {
+			if (opt.kind == "switch") continue;
+			if (!opt.flag.empty()) takesValue += (takesValue.empty() ? "" : " || ") + std::string("token == ") + literal("-" + opt.flag);
+			takesValue += (takesValue.empty() ? "" : " || ") + std::string("token == ") + literal("--" + opt.name);
+		}
+
+		os << "\t/**\n\t * Parses the command line.  Throws the TCLAP exceptions on errors.\n"
+			<< "\t * Prints the usage and throws TCLAP::ExitException(0) on -h or --help.\n\t */\n"
+			<< "\tinline " << spec.structName << " parse(int argc, const char* const* argv) {\n"
+			<< "\t\tfor (int i = 1; i < argc; i++) {\n"
+			<< "\t\t\tstd::string_view token = argv[i];\n"
+			<< "\t\t\tif (token == \"--\") break;\n"
+			<< "\t\t\tif (token == \"-h\" || token == \"--help\") {\n"
+			<< "\t\t\t\tusage(std::cout, argv[0]);\n"
+			<< "\t\t\t\tthrow TCLAP::ExitException(0);\n"
+			<< "\t\t\t}\n";
+		if (!takesValue.empty())
+			os << "\t\t\tif (" << takesValue << ") i++;\n";
+		os << "\t\t}\n"
+			<< "\t\treturn cmdLine.parse(argc, argv);\n"
+			<< "\t}\n\n";
+
+		os << "} // namespace " << spec.ns << "\n\n#endif\n";
+	}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	if (argc != 3) {
+		std::cerr << "usage: tclap-gen <spec> <header>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream in(argv[1]);
+	if (!in) {
+		std::cerr << "tclap-gen: cannot open " << argv[1] << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Spec spec;
+	try {
+		spec = readSpec(in);
+	} catch (SpecError& e) {
+		std::cerr << argv[1] << ": " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ostringstream header;
+	writeHeader(header, spec, argv[1]);
+
+	std::ofstream out(argv[2]);
+	out << header.str();
+	if (!out) {
+		std::cerr << "tclap-gen: cannot write " << argv[2] << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}